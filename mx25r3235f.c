@@ -18,6 +18,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "mx25r3235f.h"
+#include <string.h>
 
 /** @addtogroup BSP
   * @{
@@ -31,6 +32,163 @@
   * @{
   */
 
+/** @defgroup MX25R3235F_Private_Constants MX25R3235F Private Constants
+  * @{
+  */
+/* Largest register access: status + configuration registers, or ID */
+#define MX25R3235F_REG_MAX_SIZE                   3U
+
+#if defined(MX25R3235F_FIXED_MODE)
+#if (MX25R3235F_FIXED_MODE == MX25R3235F_FIXED_SPI)
+#define MX25R3235F_FIXED_READ_CMD                 MX25R3235F_FAST_READ_CMD
+#define MX25R3235F_FIXED_READ_ADDRESS_MODE        HAL_XSPI_ADDRESS_1_LINE
+#define MX25R3235F_FIXED_READ_DATA_MODE           HAL_XSPI_DATA_1_LINE
+#define MX25R3235F_FIXED_READ_DUMMY_CYCLES        DUMMY_CYCLES_READ
+#elif (MX25R3235F_FIXED_MODE == MX25R3235F_FIXED_DUAL_OUT)
+#define MX25R3235F_FIXED_READ_CMD                 MX25R3235F_DUAL_OUT_READ_CMD
+#define MX25R3235F_FIXED_READ_ADDRESS_MODE        HAL_XSPI_ADDRESS_1_LINE
+#define MX25R3235F_FIXED_READ_DATA_MODE           HAL_XSPI_DATA_2_LINES
+#define MX25R3235F_FIXED_READ_DUMMY_CYCLES        DUMMY_CYCLES_READ
+#elif (MX25R3235F_FIXED_MODE == MX25R3235F_FIXED_DUAL_IO)
+#define MX25R3235F_FIXED_READ_CMD                 MX25R3235F_DUAL_INOUT_READ_CMD
+#define MX25R3235F_FIXED_READ_ADDRESS_MODE        HAL_XSPI_ADDRESS_2_LINES
+#define MX25R3235F_FIXED_READ_DATA_MODE           HAL_XSPI_DATA_2_LINES
+#define MX25R3235F_FIXED_READ_DUMMY_CYCLES        DUMMY_CYCLES_READ_DUAL
+#elif (MX25R3235F_FIXED_MODE == MX25R3235F_FIXED_QUAD_OUT)
+#define MX25R3235F_FIXED_READ_CMD                 MX25R3235F_QUAD_OUT_READ_CMD
+#define MX25R3235F_FIXED_READ_ADDRESS_MODE        HAL_XSPI_ADDRESS_1_LINE
+#define MX25R3235F_FIXED_READ_DATA_MODE           HAL_XSPI_DATA_4_LINES
+#define MX25R3235F_FIXED_READ_DUMMY_CYCLES        DUMMY_CYCLES_READ
+#elif (MX25R3235F_FIXED_MODE == MX25R3235F_FIXED_QUAD_IO)
+#define MX25R3235F_FIXED_READ_CMD                 MX25R3235F_QUAD_INOUT_READ_CMD
+#define MX25R3235F_FIXED_READ_ADDRESS_MODE        HAL_XSPI_ADDRESS_4_LINES
+#define MX25R3235F_FIXED_READ_DATA_MODE           HAL_XSPI_DATA_4_LINES
+#define MX25R3235F_FIXED_READ_DUMMY_CYCLES        DUMMY_CYCLES_READ_QUAD
+#else
+#error "MX25R3235F_FIXED_MODE: unsupported interface mode"
+#endif
+
+#if (MX25R3235F_FIXED_MODE == MX25R3235F_FIXED_QUAD_IO)
+#define MX25R3235F_FIXED_PROG_CMD                 MX25R3235F_QUAD_PAGE_PROG_CMD
+#define MX25R3235F_FIXED_PROG_ADDRESS_MODE        HAL_XSPI_ADDRESS_4_LINES
+#define MX25R3235F_FIXED_PROG_DATA_MODE           HAL_XSPI_DATA_4_LINES
+#define MX25R3235F_FIXED_PROG_MODE                MX25R3235F_QUAD_IO_MODE
+#else
+#define MX25R3235F_FIXED_PROG_CMD                 MX25R3235F_PAGE_PROG_CMD
+#define MX25R3235F_FIXED_PROG_ADDRESS_MODE        HAL_XSPI_ADDRESS_1_LINE
+#define MX25R3235F_FIXED_PROG_DATA_MODE           HAL_XSPI_DATA_1_LINE
+#define MX25R3235F_FIXED_PROG_MODE                MX25R3235F_SPI_MODE
+#endif
+
+/* Interface modes actually used, whatever the Mode parameter */
+#define MX25R3235F_READ_MODE(MODE)                ((MX25R3235F_Interface_t)MX25R3235F_FIXED_MODE)
+#define MX25R3235F_PROG_MODE(MODE)                MX25R3235F_FIXED_PROG_MODE
+#else
+#define MX25R3235F_READ_MODE(MODE)                (MODE)
+#define MX25R3235F_PROG_MODE(MODE)                (MODE)
+#endif /* MX25R3235F_FIXED_MODE */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Private_Variables MX25R3235F Private Variables
+  * @{
+  */
+/* CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320) lookup table */
+static const uint32_t MX25R3235F_CRC32Table[256] =
+{
+  0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU, 0x076DC419U, 0x706AF48FU,
+  0xE963A535U, 0x9E6495A3U, 0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U,
+  0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U, 0x1DB71064U, 0x6AB020F2U,
+  0xF3B97148U, 0x84BE41DEU, 0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
+  0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU, 0x14015C4FU, 0x63066CD9U,
+  0xFA0F3D63U, 0x8D080DF5U, 0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U,
+  0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU, 0x35B5A8FAU, 0x42B2986CU,
+  0xDBBBC9D6U, 0xACBCF940U, 0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
+  0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U, 0x21B4F4B5U, 0x56B3C423U,
+  0xCFBA9599U, 0xB8BDA50FU, 0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U,
+  0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU, 0x76DC4190U, 0x01DB7106U,
+  0x98D220BCU, 0xEFD5102AU, 0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
+  0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U, 0x7F6A0DBBU, 0x086D3D2DU,
+  0x91646C97U, 0xE6635C01U, 0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU,
+  0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U, 0x65B0D9C6U, 0x12B7E950U,
+  0x8BBEB8EAU, 0xFCB9887CU, 0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
+  0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U, 0x4ADFA541U, 0x3DD895D7U,
+  0xA4D1C46DU, 0xD3D6F4FBU, 0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U,
+  0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U, 0x5005713CU, 0x270241AAU,
+  0xBE0B1010U, 0xC90C2086U, 0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
+  0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U, 0x59B33D17U, 0x2EB40D81U,
+  0xB7BD5C3BU, 0xC0BA6CADU, 0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU,
+  0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U, 0xE3630B12U, 0x94643B84U,
+  0x0D6D6A3EU, 0x7A6A5AA8U, 0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
+  0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU, 0xF762575DU, 0x806567CBU,
+  0x196C3671U, 0x6E6B06E7U, 0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU,
+  0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U, 0xD6D6A3E8U, 0xA1D1937EU,
+  0x38D8C2C4U, 0x4FDFF252U, 0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
+  0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U, 0xDF60EFC3U, 0xA867DF55U,
+  0x316E8EEFU, 0x4669BE79U, 0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U,
+  0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU, 0xC5BA3BBEU, 0xB2BD0B28U,
+  0x2BB45A92U, 0x5CB36A04U, 0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
+  0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU, 0x9C0906A9U, 0xEB0E363FU,
+  0x72076785U, 0x05005713U, 0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U,
+  0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U, 0x86D3D2D4U, 0xF1D4E242U,
+  0x68DDB3F8U, 0x1FDA836EU, 0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
+  0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU, 0x8F659EFFU, 0xF862AE69U,
+  0x616BFFD3U, 0x166CCF45U, 0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U,
+  0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU, 0xAED16A4AU, 0xD9D65ADCU,
+  0x40DF0B66U, 0x37D83BF0U, 0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
+  0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U, 0xBAD03605U, 0xCDD70693U,
+  0x54DE5729U, 0x23D967BFU, 0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U,
+  0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU
+};
+
+/* Datasheet maximum duration of each MX25R3235F_Operation_t (ms) */
+static const uint32_t MX25R3235F_OperationMaxTime[MX25R3235F_OPERATION_NUMBER] =
+{
+  MX25R3235F_PAGE_PROG_MAX_TIME, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME, MX25R3235F_BLOCK_32K_ERASE_MAX_TIME,
+  MX25R3235F_BLOCK_64K_ERASE_MAX_TIME, MX25R3235F_CHIP_ERASE_MAX_TIME
+};
+
+/* Percentile of each MX25R3235F_Percentile_t */
+static const uint32_t MX25R3235F_Percentile[MX25R3235F_PERCENTILE_NUMBER] = {50U, 90U, 99U};
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Private_Functions_Prototypes MX25R3235F Private Functions Prototypes
+  * @{
+  */
+static int32_t MX25R3235F_ReadConfig(MX25R3235F_Interface_t Mode, XSPI_RegularCmdTypeDef *pCommand);
+static int32_t MX25R3235F_ReadCommand(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t ReadAddr, uint32_t Size);
+static void    MX25R3235F_CRC32Callback(void *pArg, const uint8_t *pData, uint32_t Size);
+static uint32_t MX25R3235F_Compare(const uint8_t *pExpected, const uint8_t *pActual, uint32_t Size);
+static int32_t MX25R3235F_PollID(XSPI_HandleTypeDef *Ctx, uint32_t Timeout);
+static int32_t MX25R3235F_OTPLoad(XSPI_HandleTypeDef *Ctx, MX25R3235F_OTP_t *pOTP);
+static void    MX25R3235F_ProtectArea(uint8_t BP, uint8_t TB, uint32_t *pStart, uint32_t *pSize);
+static int32_t MX25R3235F_ProtectWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect, uint8_t BP, uint8_t TB);
+#if (MX25R3235F_USE_TRACE == 1U)
+static void    MX25R3235F_TraceEvent(XSPI_HandleTypeDef *Ctx, MX25R3235F_TraceOperation_t Operation,
+                                     MX25R3235F_Interface_t Mode, uint32_t Address, uint32_t Size);
+#endif /* MX25R3235F_USE_TRACE */
+static int32_t MX25R3235F_RegRead(XSPI_HandleTypeDef *Ctx, XSPI_RegularCmdTypeDef *pCommand, uint8_t *pValue);
+static int32_t MX25R3235F_RegWrite(XSPI_HandleTypeDef *Ctx, XSPI_RegularCmdTypeDef *pCommand, const uint8_t *pValue);
+#if (MX25R3235F_USE_FAULT_INJECTION == 1U)
+static int32_t MX25R3235F_FaultPoint(XSPI_HandleTypeDef *Ctx, MX25R3235F_FaultOperation_t Operation, uint32_t Address);
+#endif /* MX25R3235F_USE_FAULT_INJECTION */
+static uint8_t MX25R3235F_CalPattern(uint32_t Index);
+static int32_t MX25R3235F_CalSet(XSPI_HandleTypeDef *Ctx, uint32_t Prescaler, uint32_t SampleShifting);
+static int32_t MX25R3235F_CalCheck(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t Address,
+                                   uint8_t *pBuffer);
+static int32_t MX25R3235F_CalStep(XSPI_HandleTypeDef *Ctx, MX25R3235F_Calibration_t *pCalibration,
+                                  MX25R3235F_Interface_t Mode, uint32_t Address, uint8_t *pBuffer,
+                                  uint32_t Prescaler, uint32_t *pPassed);
+
+/**
+  * @}
+  */
+
 /** @defgroup MX25R3235F_Exported_Functions MX25R3235F Exported Functions
   * @{
   */
@@ -43,19 +201,181 @@
 int32_t MX25R3235F_GetFlashInfo(MX25R3235F_Info_t *pInfo)
 {
   /* Configure the structure with the memory configuration */
-  pInfo->FlashSize              = MX25R3235F_FLASH_SIZE;
-  pInfo->EraseBlockSize         = MX25R3235F_BLOCK_64K;
+  pInfo->FlashSize              = MX25R3235F_FLASH_SIZE * MX25R3235F_DEVICE_NUMBER;
+  pInfo->EraseBlockSize         = MX25R3235F_BLOCK_64K * MX25R3235F_DEVICE_NUMBER;
   pInfo->EraseBlocksNumber      = (MX25R3235F_FLASH_SIZE/MX25R3235F_BLOCK_64K);
-  pInfo->EraseSubBlockSize      = MX25R3235F_BLOCK_32K;
+  pInfo->EraseSubBlockSize      = MX25R3235F_BLOCK_32K * MX25R3235F_DEVICE_NUMBER;
   pInfo->EraseSubBlocksNumber   = (MX25R3235F_FLASH_SIZE/MX25R3235F_BLOCK_32K);
-  pInfo->EraseSectorSize        = MX25R3235F_SECTOR_4K;
+  pInfo->EraseSectorSize        = MX25R3235F_SECTOR_4K * MX25R3235F_DEVICE_NUMBER;
   pInfo->EraseSectorsNumber     = (MX25R3235F_FLASH_SIZE/MX25R3235F_SECTOR_4K);
-  pInfo->ProgPageSize           = MX25R3235F_PAGE_SIZE;
+  pInfo->ProgPageSize           = MX25R3235F_PAGE_SIZE * MX25R3235F_DEVICE_NUMBER;
   pInfo->ProgPagesNumber        = (MX25R3235F_FLASH_SIZE/MX25R3235F_PAGE_SIZE);
 
   return MX25R3235F_OK;
 };
 
+/**
+  * @brief  Polling WIP (Write In Progress) bit to become 0
+  *         SPI; 1-1-1
+  * @param  Ctx Component object pointer
+  * @param  Timeout Timeout for the auto-polling in ms
+  * @retval error status
+  */
+int32_t MX25R3235F_AutoPollingMemReady(XSPI_HandleTypeDef *Ctx, uint32_t Timeout)
+{
+  XSPI_RegularCmdTypeDef  sCommand = {0};
+  XSPI_AutoPollingTypeDef sConfig  = {0};
+
+  /* Configure automatic polling mode to wait for memory ready */
+  sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction        = MX25R3235F_READ_STATUS_REG_CMD;
+  sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressMode        = HAL_XSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
+  sCommand.DataMode           = HAL_XSPI_DATA_1_LINE;
+  sCommand.DummyCycles        = 0U;
+  sCommand.DataLength         = MX25R3235F_DEVICE_NUMBER;
+  sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
+
+  /* Wait for all the devices */
+  sConfig.MatchValue    = 0U;
+  sConfig.MatchMask     = MX25R3235F_DEVICE_MASK(MX25R3235F_SR_WIP);
+  sConfig.MatchMode     = HAL_XSPI_MATCH_MODE_AND;
+  sConfig.IntervalTime  = MX25R3235F_AUTOPOLLING_INTERVAL_TIME;
+  sConfig.AutomaticStop = HAL_XSPI_AUTOMATIC_STOP_ENABLE;
+
+  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (HAL_XSPI_AutoPolling(Ctx, &sConfig, Timeout) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Writes an amount of data to the XSPI memory, page by page, with an
+  *         optional verification of each programmed page.
+  *         SPI/QUAD_INOUT/; 1-1-1/1-4-4
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode, also used to read back the data
+  * @param  pData Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size Size of data to write
+  * @param  Verify Verification performed after each page program
+  * @param  pFailAddr Address of the first byte which failed the verification,
+  *         0xFFFFFFFF when no failure. Can be NULL.
+  * @note   With MX25R3235F_VERIFY_FAIL_FLAG, the data is only read back when the
+  *         P_FAIL flag of the security register is set, to locate the failure.
+  *         MX25R3235F_VERIFY_FAIL_FLAG_SKIP_ERASED does the same check but
+  *         skips the pages holding only 0xFF bytes: they are neither programmed
+  *         nor checked, the security register is only read after a program
+  *         that actually ran.
+  * @note   The data is read back in the program Mode rather than in the
+  *         fastest read mode: in QUAD_INOUT it is already the fastest one,
+  *         and in SPI the quad lines may not be usable (QE bit cleared, pins
+  *         wired as WP#/HOLD#).
+  * @note   With MX25R3235F_DUAL_FLASH set, the address and the size must be
+  *         even: each byte pair is shared by the two devices.
+  * @retval error status
+  */
+int32_t MX25R3235F_Write(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint8_t *pData, uint32_t WriteAddr,
+                         uint32_t Size, MX25R3235F_Verify_t Verify, uint32_t *pFailAddr)
+{
+  uint32_t page_buffer[MX25R3235F_PROG_PAGE_SIZE / 4U];
+  uint32_t length;
+  uint32_t offset;
+  uint8_t  secr;
+  int32_t  readback;
+
+  if (pFailAddr != NULL)
+  {
+    *pFailAddr = 0xFFFFFFFFU;
+  }
+
+  if (((WriteAddr | Size) % MX25R3235F_DEVICE_NUMBER) != 0U)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  while (Size > 0U)
+  {
+    /* Do not cross a page boundary */
+    length = MX25R3235F_PROG_PAGE_SIZE - (WriteAddr % MX25R3235F_PROG_PAGE_SIZE);
+    if (length > Size)
+    {
+      length = Size;
+    }
+
+    /* Erased data is neither programmed nor checked when asked to skip it */
+    offset = 0U;
+    while ((Verify == MX25R3235F_VERIFY_FAIL_FLAG_SKIP_ERASED) && (offset < length) && (pData[offset] == 0xFFU))
+    {
+      offset++;
+    }
+
+    if (offset != length)
+    {
+      if (MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      if (MX25R3235F_PageProgram(Ctx, Mode, pData, WriteAddr, length) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      if (MX25R3235F_AutoPollingMemReady(Ctx, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      /* Check the programmed page */
+      readback = (Verify == MX25R3235F_VERIFY_READBACK) ? 1 : 0;
+
+      if ((Verify == MX25R3235F_VERIFY_FAIL_FLAG) || (Verify == MX25R3235F_VERIFY_FAIL_FLAG_SKIP_ERASED))
+      {
+        if (MX25R3235F_ReadSecurityRegister(Ctx, &secr) != MX25R3235F_OK)
+        {
+          return MX25R3235F_ERROR;
+        }
+
+        readback = ((secr & MX25R3235F_SECR_P_FAIL) != 0U) ? 1 : 0;
+      }
+
+      if (readback != 0)
+      {
+        if (MX25R3235F_Read(Ctx, Mode, (uint8_t *)page_buffer, WriteAddr, length) != MX25R3235F_OK)
+        {
+          return MX25R3235F_ERROR;
+        }
+
+        offset = MX25R3235F_Compare(pData, (uint8_t *)page_buffer, length);
+        if ((offset != length) || (Verify != MX25R3235F_VERIFY_READBACK))
+        {
+          /* Flag set without data mismatch: report the page start address */
+          if (pFailAddr != NULL)
+          {
+            *pFailAddr = WriteAddr + ((offset != length) ? offset : 0U);
+          }
+          return MX25R3235F_ERROR;
+        }
+      }
+    }
+
+    pData     += length;
+    WriteAddr += length;
+    Size      -= length;
+  }
+
+  return MX25R3235F_OK;
+}
+
 /* Read/Write Array Commands ****************************************************/
 /**
   * @brief  Reads an amount of data from the XSPI memory.
@@ -65,74 +385,143 @@ int32_t MX25R3235F_GetFlashInfo(MX25R3235F_Info_t *pInfo)
   * @param  pData Pointer to data to be read
   * @param  ReadAddr Read start address
   * @param  Size Size of data to read
+  * @note   With MX25R3235F_DUAL_FLASH set, the address and the size must be
+  *         even: each byte pair is shared by the two devices.
   * @retval XSPI memory status
   */
 int32_t MX25R3235F_Read(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
 {
-  XSPI_RegularCmdTypeDef sCommand = {0};
+  if (((ReadAddr | Size) % MX25R3235F_DEVICE_NUMBER) != 0U)
+  {
+    return MX25R3235F_ERROR;
+  }
 
-  /* Initialize the read command */
-  sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_1_LINE;
-  sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
-  sCommand.AddressWidth       = HAL_XSPI_ADDRESS_24_BITS;
-  sCommand.Address            = ReadAddr;
-  sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
-  sCommand.DataLength         = Size;
-  sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
+  /* Send the read command */
+  if (MX25R3235F_ReadCommand(Ctx, Mode, ReadAddr, Size) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
 
-  switch(Mode)
+  /* Reception of the data */
+  if (HAL_XSPI_Receive(Ctx, pData, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
-  case MX25R3235F_SPI_MODE :
-    sCommand.Instruction = MX25R3235F_FAST_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_1_LINE;
-    sCommand.DataMode    = HAL_XSPI_DATA_1_LINE;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ;
-    break;
+    return MX25R3235F_ERROR;
+  }
 
-  case MX25R3235F_DUAL_OUT_MODE :
-    sCommand.Instruction = MX25R3235F_DUAL_OUT_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_1_LINE;
-    sCommand.DataMode    = HAL_XSPI_DATA_2_LINES;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ;
-    break;
+  return MX25R3235F_OK;
+}
 
-  case MX25R3235F_DUAL_IO_MODE :
-    sCommand.Instruction = MX25R3235F_DUAL_INOUT_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_2_LINES;
-    sCommand.DataMode    = HAL_XSPI_DATA_2_LINES;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ_DUAL;
-    break;
+/**
+  * @brief  Read a memory area chunk by chunk and pass each chunk to a callback.
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  ReadAddr Read start address
+  * @param  Size Size of the area to read
+  * @param  pBuffer Pointer to the working buffer
+  * @param  BufferSize Size of the working buffer
+  * @param  Callback Function called for each chunk received
+  * @param  pArg Argument passed to the callback
+  * @note   With MX25R3235F_USE_DMA set, the reception of a chunk in one half of
+  *         the buffer overlaps the processing of the previous chunk in the other.
+  * @retval XSPI memory status
+  */
+int32_t MX25R3235F_ReadStream(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t ReadAddr, uint32_t Size,
+                              uint8_t *pBuffer, uint32_t BufferSize, MX25R3235F_StreamCallback_t Callback, void *pArg)
+{
+#if (MX25R3235F_USE_DMA == 1U)
+  uint8_t *chunk[2];
+  uint32_t chunk_size = BufferSize / 2U;
+  uint32_t length;
+  uint32_t next_length;
+  uint32_t index = 0U;
+  uint32_t tickstart;
+
+  if (Size == 0U)
+  {
+    return MX25R3235F_OK;
+  }
 
-  case MX25R3235F_QUAD_OUT_MODE :
-    sCommand.Instruction = MX25R3235F_QUAD_OUT_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_1_LINE;
-    sCommand.DataMode    = HAL_XSPI_DATA_4_LINES;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ;
-    break;
+  if (chunk_size == 0U)
+  {
+    return MX25R3235F_ERROR;
+  }
 
-  case MX25R3235F_QUAD_IO_MODE :
-    sCommand.Instruction = MX25R3235F_QUAD_INOUT_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_4_LINES;
-    sCommand.DataMode    = HAL_XSPI_DATA_4_LINES;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ_QUAD;
-    break;
+  chunk[0] = pBuffer;
+  chunk[1] = &pBuffer[chunk_size];
 
-  default :
+  /* Start the reception of the first chunk */
+  length = (Size < chunk_size) ? Size : chunk_size;
+  if ((MX25R3235F_ReadCommand(Ctx, Mode, ReadAddr, length) != MX25R3235F_OK) ||
+      (HAL_XSPI_Receive_DMA(Ctx, chunk[0]) != HAL_OK))
+  {
+    (void)HAL_XSPI_Abort(Ctx);
     return MX25R3235F_ERROR;
   }
 
-  /* Send the command */
-  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  while (Size > 0U)
   {
-    return MX25R3235F_ERROR;
+    /* Wait for the end of the current chunk reception */
+    tickstart = HAL_GetTick();
+    while (HAL_XSPI_GetState(Ctx) != HAL_XSPI_STATE_READY)
+    {
+      if ((HAL_GetTick() - tickstart) > HAL_XSPI_TIMEOUT_DEFAULT_VALUE)
+      {
+        /* Stop the DMA before the buffer is given back to the caller */
+        (void)HAL_XSPI_Abort(Ctx);
+        return MX25R3235F_ERROR;
+      }
+    }
+
+    /* A transfer or DMA error also ends in the ready state */
+    if (HAL_XSPI_GetError(Ctx) != HAL_XSPI_ERROR_NONE)
+    {
+      (void)HAL_XSPI_Abort(Ctx);
+      return MX25R3235F_ERROR;
+    }
+
+    Size     -= length;
+    ReadAddr += length;
+
+    /* Start the reception of the next chunk in the other half of the buffer */
+    next_length = (Size < chunk_size) ? Size : chunk_size;
+    if ((next_length != 0U) &&
+        ((MX25R3235F_ReadCommand(Ctx, Mode, ReadAddr, next_length) != MX25R3235F_OK) ||
+         (HAL_XSPI_Receive_DMA(Ctx, chunk[index ^ 1U]) != HAL_OK)))
+    {
+      (void)HAL_XSPI_Abort(Ctx);
+      return MX25R3235F_ERROR;
+    }
+
+    /* Process the current chunk while the next one is in flight */
+    Callback(pArg, chunk[index], length);
+
+    length = next_length;
+    index ^= 1U;
   }
+#else
+  uint32_t length;
 
-  /* Reception of the data */
-  if (HAL_XSPI_Receive(Ctx, pData, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if ((BufferSize == 0U) && (Size != 0U))
   {
     return MX25R3235F_ERROR;
   }
 
+  while (Size > 0U)
+  {
+    length = (Size < BufferSize) ? Size : BufferSize;
+
+    if (MX25R3235F_Read(Ctx, Mode, pBuffer, ReadAddr, length) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    Callback(pArg, pBuffer, length);
+
+    Size     -= length;
+    ReadAddr += length;
+  }
+#endif /* MX25R3235F_USE_DMA */
+
   return MX25R3235F_OK;
 }
 
@@ -146,12 +535,21 @@ int32_t MX25R3235F_Read(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, ui
   * @param  Size Size of data to write. Range 1 ~ MX25R3235F_PAGE_SIZE
   * @note   Address size is forced to 3 Bytes when the 4 Bytes address size
   *         command is not available for the specified interface mode
+  * @note   With MX25R3235F_FIXED_MODE, Mode is ignored: QUAD_INOUT programs in
+  *         1-4-4, the other modes in 1-1-1.
+  * @note   With MX25R3235F_DUAL_FLASH set, the address and the size must be
+  *         even: each byte pair is shared by the two devices.
   * @retval XSPI memory status
   */
-int32_t MX25R3235F_PageProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
+int32_t MX25R3235F_PageProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
 {
   XSPI_RegularCmdTypeDef sCommand = {0};
 
+  if (((WriteAddr | Size) % MX25R3235F_DEVICE_NUMBER) != 0U)
+  {
+    return MX25R3235F_ERROR;
+  }
+
   /* Initialize the program command */
   sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_1_LINE;
   sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
@@ -162,6 +560,13 @@ int32_t MX25R3235F_PageProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t M
   sCommand.DummyCycles        = 0U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
+#if defined(MX25R3235F_FIXED_MODE)
+  (void)Mode;
+
+  sCommand.Instruction = MX25R3235F_FIXED_PROG_CMD;
+  sCommand.AddressMode = MX25R3235F_FIXED_PROG_ADDRESS_MODE;
+  sCommand.DataMode    = MX25R3235F_FIXED_PROG_DATA_MODE;
+#else
   switch(Mode)
   {
   case MX25R3235F_SPI_MODE :
@@ -179,6 +584,7 @@ int32_t MX25R3235F_PageProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t M
   default :
     return MX25R3235F_ERROR;
   }
+#endif /* MX25R3235F_FIXED_MODE */
 
   /* Configure the command */
   if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
@@ -192,6 +598,17 @@ int32_t MX25R3235F_PageProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t M
     return MX25R3235F_ERROR;
   }
 
+#if (MX25R3235F_USE_TRACE == 1U)
+  MX25R3235F_TraceEvent(Ctx, MX25R3235F_TRACE_PROGRAM, MX25R3235F_PROG_MODE(Mode), WriteAddr, Size);
+#endif /* MX25R3235F_USE_TRACE */
+
+#if (MX25R3235F_USE_FAULT_INJECTION == 1U)
+  if (MX25R3235F_FaultPoint(Ctx, MX25R3235F_FAULT_PROGRAM, WriteAddr) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+#endif /* MX25R3235F_USE_FAULT_INJECTION */
+
   return MX25R3235F_OK;
 }
 
@@ -242,6 +659,19 @@ int32_t MX25R3235F_BlockErase(XSPI_HandleTypeDef *Ctx, uint32_t BlockAddress, MX
     return MX25R3235F_ERROR;
   }
 
+#if (MX25R3235F_USE_TRACE == 1U)
+  MX25R3235F_TraceEvent(Ctx, MX25R3235F_TRACE_ERASE, MX25R3235F_SPI_MODE, BlockAddress,
+                        (BlockSize == MX25R3235F_ERASE_4K) ? MX25R3235F_SECTOR_4K :
+                        ((BlockSize == MX25R3235F_ERASE_32K) ? MX25R3235F_BLOCK_32K : MX25R3235F_BLOCK_64K));
+#endif /* MX25R3235F_USE_TRACE */
+
+#if (MX25R3235F_USE_FAULT_INJECTION == 1U)
+  if (MX25R3235F_FaultPoint(Ctx, MX25R3235F_FAULT_ERASE, BlockAddress) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+#endif /* MX25R3235F_USE_FAULT_INJECTION */
+
   return MX25R3235F_OK;
 }
 
@@ -271,6 +701,17 @@ int32_t MX25R3235F_ChipErase(XSPI_HandleTypeDef *Ctx)
     return MX25R3235F_ERROR;
   }
 
+#if (MX25R3235F_USE_TRACE == 1U)
+  MX25R3235F_TraceEvent(Ctx, MX25R3235F_TRACE_ERASE, MX25R3235F_SPI_MODE, 0U, MX25R3235F_FLASH_SIZE);
+#endif /* MX25R3235F_USE_TRACE */
+
+#if (MX25R3235F_USE_FAULT_INJECTION == 1U)
+  if (MX25R3235F_FaultPoint(Ctx, MX25R3235F_FAULT_ERASE, 0U) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+#endif /* MX25R3235F_USE_FAULT_INJECTION */
+
   return MX25R3235F_OK;
 }
 
@@ -294,44 +735,8 @@ int32_t MX25R3235F_EnableMemoryMappedMode(XSPI_HandleTypeDef *Ctx, MX25R3235F_In
   sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  switch(Mode)
+  if (MX25R3235F_ReadConfig(Mode, &sCommand) != MX25R3235F_OK)
   {
-  case MX25R3235F_SPI_MODE :
-    sCommand.Instruction = MX25R3235F_FAST_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_1_LINE;
-    sCommand.DataMode    = HAL_XSPI_DATA_1_LINE;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ;
-    break;
-
-  case MX25R3235F_DUAL_OUT_MODE :
-    sCommand.Instruction = MX25R3235F_DUAL_OUT_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_1_LINE;
-    sCommand.DataMode    = HAL_XSPI_DATA_2_LINES;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ;
-    break;
-
-  case MX25R3235F_DUAL_IO_MODE :
-    sCommand.Instruction = MX25R3235F_DUAL_INOUT_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_2_LINES;
-    sCommand.DataMode    = HAL_XSPI_DATA_2_LINES;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ_DUAL;
-    break;
-
-  case MX25R3235F_QUAD_OUT_MODE :
-    sCommand.Instruction = MX25R3235F_QUAD_OUT_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_1_LINE;
-    sCommand.DataMode    = HAL_XSPI_DATA_4_LINES;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ;
-    break;
-
-  case MX25R3235F_QUAD_IO_MODE :
-    sCommand.Instruction = MX25R3235F_QUAD_INOUT_READ_CMD;
-    sCommand.AddressMode = HAL_XSPI_ADDRESS_4_LINES;
-    sCommand.DataMode    = HAL_XSPI_DATA_4_LINES;
-    sCommand.DummyCycles = DUMMY_CYCLES_READ_QUAD;
-    break;
-
-  default :
     return MX25R3235F_ERROR;
   }
 
@@ -353,6 +758,23 @@ int32_t MX25R3235F_EnableMemoryMappedMode(XSPI_HandleTypeDef *Ctx, MX25R3235F_In
   return MX25R3235F_OK;
 }
 
+/**
+  * @brief  Disable memory mapped mode for the XSPI memory.
+  * @param  Ctx Component object pointer
+  * @note   Required before any indirect command (read, program, erase...).
+  * @retval XSPI memory status
+  */
+int32_t MX25R3235F_DisableMemoryMappedMode(XSPI_HandleTypeDef *Ctx)
+{
+  /* Abort the memory mapped transfer and get back to indirect mode */
+  if (HAL_XSPI_Abort(Ctx) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
 /**
   * @brief  Flash suspend program or erase command
   * @param  Ctx Component object pointer
@@ -409,6 +831,77 @@ int32_t MX25R3235F_Resume(XSPI_HandleTypeDef *Ctx)
   return MX25R3235F_OK;
 }
 
+/* Verification Commands ******************************************************/
+/**
+  * @brief  Update a CRC-32 (IEEE 802.3) with a block of data.
+  * @param  Crc Current CRC value, 0 to start a new computation
+  * @param  pData Pointer to data
+  * @param  Size Size of data
+  * @note   Table driven software implementation. It can be overridden by the
+  *         application to use a CRC hardware unit (same polynomial, reflected
+  *         input/output, 0xFFFFFFFF initial value and final XOR).
+  * @retval Updated CRC value
+  */
+__weak uint32_t MX25R3235F_CRC32(uint32_t Crc, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t crc = ~Crc;
+  uint32_t index;
+
+  for (index = 0U; index < Size; index++)
+  {
+    crc = MX25R3235F_CRC32Table[(crc ^ pData[index]) & 0xFFU] ^ (crc >> 8);
+  }
+
+  return ~crc;
+}
+
+/**
+  * @brief  Compute the CRC-32 of a memory area without a full size read buffer.
+  *         SPI/DUAL_OUT/DUAL_INOUT/QUAD_OUT/QUAD_INOUT/; 1-1-1/1-1-2/1-2-2/1-1-4/1-4-4
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  ReadAddr Read start address
+  * @param  Size Size of the area to check
+  * @param  pBuffer Pointer to the working buffer
+  * @param  BufferSize Size of the working buffer
+  * @param  pCrc CRC pointer. Holds the initial value on entry (0 to start a
+  *         new computation) and the updated value on exit
+  * @note   The area is read in chunks of BufferSize bytes. When MX25R3235F_USE_DMA
+  *         is set, the buffer is split in two halves: the next chunk is received
+  *         by DMA while the current one is folded into the CRC.
+  * @retval XSPI memory status
+  */
+int32_t MX25R3235F_ReadCRC32(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t ReadAddr, uint32_t Size,
+                             uint8_t *pBuffer, uint32_t BufferSize, uint32_t *pCrc)
+{
+  return MX25R3235F_ReadStream(Ctx, Mode, ReadAddr, Size, pBuffer, BufferSize, MX25R3235F_CRC32Callback, pCrc);
+}
+
+/* Storage Helper Commands ****************************************************/
+/**
+  * @brief  Read a little endian 32-bit value.
+  * @param  pData Pointer to the value
+  * @retval Value
+  */
+uint32_t MX25R3235F_Get32(const uint8_t *pData)
+{
+  return (uint32_t)pData[0] | ((uint32_t)pData[1] << 8) | ((uint32_t)pData[2] << 16) | ((uint32_t)pData[3] << 24);
+}
+
+/**
+  * @brief  Write a little endian 32-bit value.
+  * @param  pData Pointer to the value
+  * @param  Value Value
+  * @retval None
+  */
+void MX25R3235F_Put32(uint8_t *pData, uint32_t Value)
+{
+  pData[0] = (uint8_t)Value;
+  pData[1] = (uint8_t)(Value >> 8);
+  pData[2] = (uint8_t)(Value >> 16);
+  pData[3] = (uint8_t)(Value >> 24);
+}
+
 /* Register/Setting Commands **************************************************/
 /**
   * @brief  This function send a Write Enable and wait it is effective.
@@ -491,14 +984,8 @@ int32_t MX25R3235F_ReadStatusRegister(XSPI_HandleTypeDef *Ctx, uint8_t *Value)
   sCommand.DataLength         = 1U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  /* Send the command */
-  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-  {
-    return MX25R3235F_ERROR;
-  }
-
-  /* Reception of the data */
-  if (HAL_XSPI_Receive(Ctx, Value, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  /* Send the command and receive the data */
+  if (MX25R3235F_RegRead(Ctx, &sCommand, Value) != MX25R3235F_OK)
   {
     return MX25R3235F_ERROR;
   }
@@ -541,14 +1028,8 @@ int32_t MX25R3235F_WriteStatusRegister(XSPI_HandleTypeDef *Ctx, uint8_t Value)
   sCommand.DataLength         = 3U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  /* Send the command */
-  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-  {
-    return MX25R3235F_ERROR;
-  }
-
-  /* Transmission of the data */
-  if (HAL_XSPI_Transmit(Ctx, reg, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  /* Send the command and transmit the data */
+  if (MX25R3235F_RegWrite(Ctx, &sCommand, reg) != MX25R3235F_OK)
   {
     return MX25R3235F_ERROR;
   }
@@ -591,14 +1072,8 @@ int32_t MX25R3235F_WriteCfgRegister(XSPI_HandleTypeDef *Ctx, uint8_t Value)
   sCommand.DataLength         = 3U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  /* Send the command */
-  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-  {
-    return MX25R3235F_ERROR;
-  }
-
-  /* Transmission of the data */
-  if (HAL_XSPI_Transmit(Ctx, reg, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  /* Send the command and transmit the data */
+  if (MX25R3235F_RegWrite(Ctx, &sCommand, reg) != MX25R3235F_OK)
   {
     return MX25R3235F_ERROR;
   }
@@ -628,14 +1103,8 @@ int32_t MX25R3235F_ReadCfgRegister(XSPI_HandleTypeDef *Ctx, uint8_t *Value)
   sCommand.DataLength         = 2U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  /* Send the command */
-  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-  {
-    return MX25R3235F_ERROR;
-  }
-
-  /* Reception of the data */
-  if (HAL_XSPI_Receive(Ctx, reg, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  /* Send the command and receive the data */
+  if (MX25R3235F_RegRead(Ctx, &sCommand, reg) != MX25R3235F_OK)
   {
     return MX25R3235F_ERROR;
   }
@@ -680,14 +1149,8 @@ int32_t MX25R3235F_WriteCfg2Register(XSPI_HandleTypeDef *Ctx, uint8_t Value)
   sCommand.DataLength         = 3U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  /* Send the command */
-  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-  {
-    return MX25R3235F_ERROR;
-  }
-
-  /* Transmission of the data */
-  if (HAL_XSPI_Transmit(Ctx, reg, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  /* Send the command and transmit the data */
+  if (MX25R3235F_RegWrite(Ctx, &sCommand, reg) != MX25R3235F_OK)
   {
     return MX25R3235F_ERROR;
   }
@@ -717,14 +1180,8 @@ int32_t MX25R3235F_ReadCfg2Register(XSPI_HandleTypeDef *Ctx, uint8_t *Value)
   sCommand.DataLength         = 2U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  /* Send the command */
-  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-  {
-    return MX25R3235F_ERROR;
-  }
-
-  /* Reception of the data */
-  if (HAL_XSPI_Receive(Ctx, reg, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  /* Send the command and receive the data */
+  if (MX25R3235F_RegRead(Ctx, &sCommand, reg) != MX25R3235F_OK)
   {
     return MX25R3235F_ERROR;
   }
@@ -755,14 +1212,8 @@ int32_t MX25R3235F_WriteSecurityRegister(XSPI_HandleTypeDef *Ctx, uint8_t Value)
   sCommand.DataLength         = 1U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  /* Send the command */
-  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
-  {
-    return MX25R3235F_ERROR;
-  }
-
-  /* Transmission of the data */
-  if (HAL_XSPI_Transmit(Ctx, &Value, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  /* Send the command and transmit the data */
+  if (MX25R3235F_RegWrite(Ctx, &sCommand, &Value) != MX25R3235F_OK)
   {
     return MX25R3235F_ERROR;
   }
@@ -791,21 +1242,194 @@ int32_t MX25R3235F_ReadSecurityRegister(XSPI_HandleTypeDef *Ctx, uint8_t *Value)
   sCommand.DataLength         = 1U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  /* Send the command */
-  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  /* Send the command and receive the data */
+  if (MX25R3235F_RegRead(Ctx, &sCommand, Value) != MX25R3235F_OK)
   {
     return MX25R3235F_ERROR;
   }
 
-  /* Reception of the data */
-  if (HAL_XSPI_Receive(Ctx, Value, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  return MX25R3235F_OK;
+}
+
+
+/* Block Protection Commands **************************************************/
+/**
+  * @brief  Load the status and configuration registers in the protection cache
+  * @param  Ctx Component object pointer
+  * @param  pProtect Block protection cache pointer
+  * @note   The other block protection functions work on the cached values and
+  *         only access the memory to update the registers.
+  * @retval error status
+  */
+int32_t MX25R3235F_ProtectLoad(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect)
+{
+  XSPI_RegularCmdTypeDef sCommand = {0};
+
+  if (MX25R3235F_ReadStatusRegister(Ctx, &pProtect->Reg[0]) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Both configuration registers are read by a single command */
+  sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction        = MX25R3235F_READ_CFG_REG_CMD;
+  sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressMode        = HAL_XSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
+  sCommand.DataMode           = HAL_XSPI_DATA_1_LINE;
+  sCommand.DummyCycles        = 0U;
+  sCommand.DataLength         = 2U;
+  sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
+
+  if (MX25R3235F_RegRead(Ctx, &sCommand, &pProtect->Reg[1]) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pProtect->LockedBP = pProtect->Reg[0] & MX25R3235F_SR_BP;
+  pProtect->Loaded   = 1U;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Get the area currently protected
+  * @param  pProtect Block protection cache pointer
+  * @param  pStart Start address of the protected area
+  * @param  pSize Size of the protected area, 0 when nothing is protected
+  * @retval error status
+  */
+int32_t MX25R3235F_GetProtectedArea(const MX25R3235F_Protect_t *pProtect, uint32_t *pStart, uint32_t *pSize)
+{
+  if (pProtect->Loaded == 0U)
   {
     return MX25R3235F_ERROR;
   }
 
+  MX25R3235F_ProtectArea((pProtect->Reg[0] & MX25R3235F_SR_BP) >> 2, pProtect->Reg[1] & MX25R3235F_CR1_TB,
+                         pStart, pSize);
+
   return MX25R3235F_OK;
 }
 
+/**
+  * @brief  Protect an address range with the smallest block protection area
+  * @param  Ctx Component object pointer
+  * @param  pProtect Block protection cache pointer
+  * @param  Address Start address of the range to protect
+  * @param  Size Size of the range to protect, 0 to remove all protection
+  * @param  AllowBottom Allow to select the bottom area when it is smaller
+  * @note   The TB bit is one time programmable: once the bottom area has been
+  *         selected, only bottom areas can be used.
+  * @retval error status
+  */
+int32_t MX25R3235F_ProtectRange(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect, uint32_t Address,
+                                uint32_t Size, uint32_t AllowBottom)
+{
+  uint8_t  tb;
+  uint8_t  bp;
+  uint8_t  bp_top    = 0xFFU;
+  uint8_t  bp_bottom = 0xFFU;
+  uint32_t start;
+  uint32_t size;
+
+  if ((pProtect->Loaded == 0U) || (Address > MX25R3235F_FLASH_SIZE) || (Size > (MX25R3235F_FLASH_SIZE - Address)))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Smallest covering area for each orientation (7 protects the whole array) */
+  for (bp = 7U; bp != 0xFFU; bp--)
+  {
+    MX25R3235F_ProtectArea(bp, 0U, &start, &size);
+    if ((Size == 0U) || ((Address >= start) && ((Address + Size) <= (start + size))))
+    {
+      bp_top = bp;
+    }
+
+    MX25R3235F_ProtectArea(bp, MX25R3235F_CR1_TB, &start, &size);
+    if ((Size == 0U) || ((Address >= start) && ((Address + Size) <= (start + size))))
+    {
+      bp_bottom = bp;
+    }
+  }
+
+  tb = pProtect->Reg[1] & MX25R3235F_CR1_TB;
+  bp = (tb != 0U) ? bp_bottom : bp_top;
+  if ((tb == 0U) && (AllowBottom != 0U) && (bp_bottom < bp_top))
+  {
+    tb = MX25R3235F_CR1_TB;
+    bp = bp_bottom;
+  }
+
+  pProtect->LockedBP = (uint8_t)(bp << 2);
+
+  return MX25R3235F_ProtectWrite(Ctx, pProtect, pProtect->LockedBP, tb);
+}
+
+/**
+  * @brief  Open an unlock window on an address range
+  * @param  Ctx Component object pointer
+  * @param  pProtect Block protection cache pointer
+  * @param  Address Start address of the range to update
+  * @param  Size Size of the range to update
+  * @note   The protected area is reduced to the largest area which does not
+  *         overlap the range. Nothing is written to the memory when the range
+  *         is not protected. MX25R3235F_UnlockEnd() restores the protection.
+  * @retval error status
+  */
+int32_t MX25R3235F_UnlockBegin(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect, uint32_t Address, uint32_t Size)
+{
+  uint8_t  tb;
+  uint8_t  bp;
+  uint32_t start;
+  uint32_t size;
+
+  if (pProtect->Loaded == 0U)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  tb = pProtect->Reg[1] & MX25R3235F_CR1_TB;
+
+  for (bp = (pProtect->Reg[0] & MX25R3235F_SR_BP) >> 2; bp > 0U; bp--)
+  {
+    MX25R3235F_ProtectArea(bp, tb, &start, &size);
+    if ((Size == 0U) || ((Address + Size) <= start) || (Address >= (start + size)))
+    {
+      break;
+    }
+  }
+
+  if ((uint8_t)(bp << 2) == (pProtect->Reg[0] & MX25R3235F_SR_BP))
+  {
+    return MX25R3235F_OK;
+  }
+
+  return MX25R3235F_ProtectWrite(Ctx, pProtect, (uint8_t)(bp << 2), tb);
+}
+
+/**
+  * @brief  Close an unlock window
+  * @param  Ctx Component object pointer
+  * @param  pProtect Block protection cache pointer
+  * @note   Nothing is written to the memory when the protection is unchanged.
+  * @retval error status
+  */
+int32_t MX25R3235F_UnlockEnd(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect)
+{
+  if (pProtect->Loaded == 0U)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (pProtect->LockedBP == (pProtect->Reg[0] & MX25R3235F_SR_BP))
+  {
+    return MX25R3235F_OK;
+  }
+
+  return MX25R3235F_ProtectWrite(Ctx, pProtect, pProtect->LockedBP, pProtect->Reg[1] & MX25R3235F_CR1_TB);
+}
 
 /* ID Commands ****************************************************************/
 /**
@@ -830,21 +1454,205 @@ int32_t MX25R3235F_ReadID(XSPI_HandleTypeDef *Ctx, uint8_t *ID)
   sCommand.DataLength         = 3U;
   sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
 
-  /* Configure the command */
+  /* Send the command and receive the data */
+  if (MX25R3235F_RegRead(Ctx, &sCommand, ID) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/* Secured OTP Commands *******************************************************/
+/**
+  * @brief  Flash enter secured OTP command
+  * @param  Ctx Component object pointer
+  * @note   Array read and program commands access the secured OTP area
+  *         until MX25R3235F_ExitSecuredOTP() is called.
+  * @retval error status
+  */
+int32_t MX25R3235F_EnterSecuredOTP(XSPI_HandleTypeDef *Ctx)
+{
+  XSPI_RegularCmdTypeDef sCommand = {0};
+
+  /* Initialize the enter secured OTP command */
+  sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction        = MX25R3235F_ENTER_SECURED_OTP_CMD;
+  sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressMode        = HAL_XSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
+  sCommand.DataMode           = HAL_XSPI_DATA_NONE;
+  sCommand.DummyCycles        = 0U;
+  sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
+
+  /* Send the command */
   if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return MX25R3235F_ERROR;
   }
 
-  /* Reception of the data */
-  if (HAL_XSPI_Receive(Ctx, ID, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Flash exit secured OTP command
+  * @param  Ctx Component object pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_ExitSecuredOTP(XSPI_HandleTypeDef *Ctx)
+{
+  XSPI_RegularCmdTypeDef sCommand = {0};
+
+  /* Initialize the exit secured OTP command */
+  sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction        = MX25R3235F_EXIT_SECURED_OTP_CMD;
+  sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressMode        = HAL_XSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
+  sCommand.DataMode           = HAL_XSPI_DATA_NONE;
+  sCommand.DummyCycles        = 0U;
+  sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
+
+  /* Send the command */
+  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Read data from the secured OTP area
+  * @param  Ctx Component object pointer
+  * @param  pOTP Secured OTP cache pointer, Loaded field cleared before first use
+  * @param  pData Pointer to data to be read
+  * @param  ReadAddr Read start address in the secured OTP area
+  * @param  Size Size of data to read
+  * @note   The whole area and the security register are read once and kept in
+  *         the cache. Following reads are served from RAM.
+  * @retval error status
+  */
+int32_t MX25R3235F_OTPRead(XSPI_HandleTypeDef *Ctx, MX25R3235F_OTP_t *pOTP, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+{
+  if ((ReadAddr > MX25R3235F_OTP_SIZE) || (Size > (MX25R3235F_OTP_SIZE - ReadAddr)))
   {
     return MX25R3235F_ERROR;
   }
 
+  if (pOTP->Loaded == 0U)
+  {
+    if (MX25R3235F_OTPLoad(Ctx, pOTP) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+  }
+
+  (void)memcpy(pData, &pOTP->Data[ReadAddr], Size);
+
   return MX25R3235F_OK;
 }
 
+/**
+  * @brief  Program data in the secured OTP area
+  * @param  Ctx Component object pointer
+  * @param  pOTP Secured OTP cache pointer
+  * @param  pData Pointer to data to be written
+  * @param  WriteAddr Write start address in the secured OTP area
+  * @param  Size Size of data to write
+  * @note   Rejected when the area is locked (LDSO), or when the factory
+  *         area is targeted and factory locked (SOI). Each page is read back
+  *         and the cache is refreshed.
+  * @retval error status
+  */
+int32_t MX25R3235F_OTPProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_OTP_t *pOTP, uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
+{
+  int32_t ret;
+
+  if ((WriteAddr > MX25R3235F_OTP_SIZE) || (Size > (MX25R3235F_OTP_SIZE - WriteAddr)))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (pOTP->Loaded == 0U)
+  {
+    if (MX25R3235F_OTPLoad(Ctx, pOTP) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+  }
+
+  if (((pOTP->SecurityReg & MX25R3235F_SECR_LDSO) != 0U) ||
+      (((pOTP->SecurityReg & MX25R3235F_SECR_SOI) != 0U) && (WriteAddr < MX25R3235F_OTP_FACTORY_SIZE)))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_EnterSecuredOTP(Ctx) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  ret = MX25R3235F_Write(Ctx, MX25R3235F_SPI_MODE, pData, WriteAddr, Size, MX25R3235F_VERIFY_READBACK, NULL);
+
+  /* Always leave the secured OTP mode */
+  if (MX25R3235F_ExitSecuredOTP(Ctx) != MX25R3235F_OK)
+  {
+    ret = MX25R3235F_ERROR;
+  }
+
+  if (ret == MX25R3235F_OK)
+  {
+    /* Cells can only be programmed from 1 to 0 */
+    while (Size > 0U)
+    {
+      pOTP->Data[WriteAddr] &= *pData;
+      WriteAddr++;
+      pData++;
+      Size--;
+    }
+  }
+  else
+  {
+    /* Content unknown: reload on next access */
+    pOTP->Loaded = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Lock down the secured OTP area
+  * @param  Ctx Component object pointer
+  * @param  pOTP Secured OTP cache pointer
+  * @note   Irreversible. The LDSO bit of the security register is set.
+  * @retval error status
+  */
+int32_t MX25R3235F_OTPLock(XSPI_HandleTypeDef *Ctx, MX25R3235F_OTP_t *pOTP)
+{
+  if (MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_WriteSecurityRegister(Ctx, MX25R3235F_SECR_LDSO) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_WRITE_REG_MAX_TIME) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_ReadSecurityRegister(Ctx, &pOTP->SecurityReg) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return ((pOTP->SecurityReg & MX25R3235F_SECR_LDSO) != 0U) ? MX25R3235F_OK : MX25R3235F_ERROR;
+}
+
 /* Reset Commands *************************************************************/
 /**
   * @brief  Flash reset enable command
@@ -902,6 +1710,41 @@ int32_t MX25R3235F_ResetMemory(XSPI_HandleTypeDef *Ctx)
   return MX25R3235F_OK;
 }
 
+/**
+  * @brief  Flash release read enhanced command
+  *         QPI; 4-4-4
+  * @param  Ctx Component object pointer
+  * @note   Eight clocks with IO0-IO3 high: a memory left in the 4 I/O
+  *         performance enhance (continuous read) mode takes them as the
+  *         address and a mode byte that is not 0xA5, and leaves the mode. A
+  *         memory in normal mode ignores the unknown 0xFF instruction.
+  * @retval error status
+  */
+int32_t MX25R3235F_ReleaseReadEnhanced(XSPI_HandleTypeDef *Ctx)
+{
+  XSPI_RegularCmdTypeDef sCommand = {0};
+
+  /* Initialize the release read enhanced command */
+  sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_4_LINES;
+  sCommand.Instruction        = MX25R3235F_RELEASE_READ_ENHANCED_CMD;
+  sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressMode        = HAL_XSPI_ADDRESS_4_LINES;
+  sCommand.AddressWidth       = HAL_XSPI_ADDRESS_24_BITS;
+  sCommand.Address            = 0xFFFFFFU;
+  sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
+  sCommand.DataMode           = HAL_XSPI_DATA_NONE;
+  sCommand.DummyCycles        = 0U;
+  sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
+
+  /* Send the command */
+  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
 /**
   * @brief  Flash no operation command
   * @param  Ctx Component object pointer
@@ -958,6 +1801,1491 @@ int32_t MX25R3235F_EnterPowerDown(XSPI_HandleTypeDef *Ctx)
   return MX25R3235F_OK;
 }
 
+/**
+  * @brief  Flash release from deep power-down command
+  * @param  Ctx Component object pointer
+  * @note   The memory is ready after tRES1. Use MX25R3235F_PowerWakeUp() to
+  *         wait for it.
+  * @retval error status
+  */
+int32_t MX25R3235F_LeavePowerDown(XSPI_HandleTypeDef *Ctx)
+{
+  XSPI_RegularCmdTypeDef sCommand = {0};
+
+  /* Initialize the release from power down command */
+  sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction        = MX25R3235F_RELEASE_DEEP_POWER_DOWN_CMD;
+  sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressMode        = HAL_XSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
+  sCommand.DataMode           = HAL_XSPI_DATA_NONE;
+  sCommand.DummyCycles        = 0U;
+  sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
+
+  /* Send the command */
+  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Bring the memory back to a known state after a warm reset
+  * @param  Ctx Component object pointer
+  * @note   The memory may have been left in continuous read mode, in deep
+  *         power-down or busy with a program or erase. The continuous read
+  *         mode is released, the memory is woken up, given tRES1 and reset,
+  *         then it is polled with Read ID and on its WIP bit (Read ID is not
+  *         decoded while a program or erase is in progress, so it is only
+  *         polled once the reset is sent): the time taken is the time
+  *         the memory actually needs, MX25R3235F_RESET_MAX_TIME being only the
+  *         timeout (reset during a chip erase).
+  * @retval error status
+  */
+int32_t MX25R3235F_Recover(XSPI_HandleTypeDef *Ctx)
+{
+  if ((MX25R3235F_ReleaseReadEnhanced(Ctx) != MX25R3235F_OK) ||
+      (MX25R3235F_LeavePowerDown(Ctx) != MX25R3235F_OK))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Wait for tRES1 with a fixed delay (one tick is longer): a memory in deep
+     power-down ignores the reset, and a busy memory does not answer Read ID
+     until it is reset */
+  HAL_Delay(1U);
+
+  if ((MX25R3235F_ResetEnable(Ctx) != MX25R3235F_OK) ||
+      (MX25R3235F_ResetMemory(Ctx) != MX25R3235F_OK))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_PollID(Ctx, MX25R3235F_RESET_MAX_TIME * 1000U) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_RESET_MAX_TIME);
+}
+
+/* Power Management Commands **************************************************/
+/**
+  * @brief  Initialize the deep power-down manager
+  * @param  pPower Power manager pointer
+  * @param  IdleTime Idle time in ms before entering deep power-down, 0 to disable
+  * @note   The memory is considered active (not in deep power-down).
+  * @retval error status
+  */
+int32_t MX25R3235F_PowerInit(MX25R3235F_Power_t *pPower, uint32_t IdleTime)
+{
+  (void)memset(pPower, 0, sizeof(MX25R3235F_Power_t));
+
+  pPower->IdleTime       = IdleTime;
+  pPower->State          = MX25R3235F_POWER_ACTIVE;
+  pPower->LastAccessTick = HAL_GetTick();
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Wake the memory up if needed before an access
+  * @param  Ctx Component object pointer
+  * @param  pPower Power manager pointer
+  * @note   To be called before each Read, Program or Erase. When the memory is
+  *         in deep power-down, the release command is sent and the memory is
+  *         polled with Read ID until it answers (tRES1), instead of waiting
+  *         the worst case. Otherwise only the idle timer is restarted. The
+  *         wake-up latency is measured with MX25R3235F_TimingGetTime().
+  * @retval error status
+  */
+int32_t MX25R3235F_PowerWakeUp(XSPI_HandleTypeDef *Ctx, MX25R3235F_Power_t *pPower)
+{
+  uint32_t timestart;
+  uint32_t latency;
+
+  if (pPower->State == MX25R3235F_POWER_DOWN)
+  {
+    timestart = MX25R3235F_TimingGetTime();
+
+    if (MX25R3235F_LeavePowerDown(Ctx) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if (MX25R3235F_PollID(Ctx, MX25R3235F_RELEASE_POWER_DOWN_MAX_TIME) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    latency = MX25R3235F_TimingGetTime() - timestart;
+
+    /* Update statistics */
+    pPower->State          = MX25R3235F_POWER_ACTIVE;
+    pPower->PowerDownTime += HAL_GetTick() - pPower->PowerDownTick;
+    pPower->WakeUpCount++;
+    pPower->WakeUpLatency += latency;
+    if (latency > pPower->WakeUpLatencyMax)
+    {
+      pPower->WakeUpLatencyMax = latency;
+    }
+  }
+
+  pPower->LastAccessTick = HAL_GetTick();
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Enter deep power-down when the memory has been idle long enough
+  * @param  Ctx Component object pointer
+  * @param  pPower Power manager pointer
+  * @note   To be called periodically (idle task, timer). The memory is kept
+  *         active while a program or erase operation is in progress. It must
+  *         not be called while memory mapped mode is enabled.
+  * @retval error status
+  */
+int32_t MX25R3235F_PowerProcess(XSPI_HandleTypeDef *Ctx, MX25R3235F_Power_t *pPower)
+{
+  uint8_t reg;
+
+  if ((pPower->State == MX25R3235F_POWER_DOWN) || (pPower->IdleTime == 0U) ||
+      ((HAL_GetTick() - pPower->LastAccessTick) < pPower->IdleTime))
+  {
+    return MX25R3235F_OK;
+  }
+
+  if (MX25R3235F_ReadStatusRegister(Ctx, &reg) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if ((reg & MX25R3235F_SR_WIP) != 0U)
+  {
+    /* Operation in progress: check again after another idle period */
+    pPower->LastAccessTick = HAL_GetTick();
+    return MX25R3235F_OK;
+  }
+
+  if (MX25R3235F_EnterPowerDown(Ctx) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pPower->State         = MX25R3235F_POWER_DOWN;
+  pPower->PowerDownTick = HAL_GetTick();
+  pPower->PowerDownCount++;
+
+  return MX25R3235F_OK;
+}
+
+/* Operation Timing Commands **************************************************/
+/**
+  * @brief  Initialize the operation timing statistics
+  * @param  pTiming Timing statistics pointer
+  * @note   The driver keeps no state of its own, so it cannot record the
+  *         operations by itself: the application calls
+  *         MX25R3235F_TimingStart() once a program or erase is issued, then
+  *         MX25R3235F_TimingWait() (or MX25R3235F_TimingStop() once it sees
+  *         the WIP bit cleared). Durations are in us, measured with
+  *         MX25R3235F_TimingGetTime().
+  * @retval error status
+  */
+int32_t MX25R3235F_TimingInit(MX25R3235F_Timing_t *pTiming)
+{
+  (void)memset(pTiming, 0, sizeof(MX25R3235F_Timing_t));
+  pTiming->Current = MX25R3235F_OPERATION_NUMBER;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Record the start of a program or erase operation
+  * @param  pTiming Timing statistics pointer
+  * @param  Operation Operation just issued to the memory
+  * @retval error status
+  */
+int32_t MX25R3235F_TimingStart(MX25R3235F_Timing_t *pTiming, MX25R3235F_Operation_t Operation)
+{
+  if (Operation >= MX25R3235F_OPERATION_NUMBER)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pTiming->Current   = Operation;
+  pTiming->StartTime = MX25R3235F_TimingGetTime();
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Record the end of the current operation and update its statistics
+  * @param  pTiming Timing statistics pointer
+  * @note   Call it as soon as the end of the operation is observed (WIP bit
+  *         cleared), the measured duration includes the detection latency.
+  * @retval error status
+  */
+int32_t MX25R3235F_TimingStop(MX25R3235F_Timing_t *pTiming)
+{
+  MX25R3235F_OperationTiming_t *op;
+  uint32_t duration;
+  uint32_t sample;
+  uint32_t step;
+  uint32_t index;
+
+  if (pTiming->Current >= MX25R3235F_OPERATION_NUMBER)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  op       = &pTiming->Operation[pTiming->Current];
+  duration = MX25R3235F_TimingGetTime() - pTiming->StartTime;
+
+  /* Keep the fixed point sample within 32 bits */
+  if (duration > (0xFFFFFFFFU >> MX25R3235F_TIMING_SHIFT))
+  {
+    duration = 0xFFFFFFFFU >> MX25R3235F_TIMING_SHIFT;
+  }
+  sample   = duration << MX25R3235F_TIMING_SHIFT;
+  pTiming->Current = MX25R3235F_OPERATION_NUMBER;
+
+  if (op->Count == 0U)
+  {
+    op->Min  = duration;
+    op->Max  = duration;
+    op->Mean = sample;
+    for (index = 0U; index < MX25R3235F_PERCENTILE_NUMBER; index++)
+    {
+      op->Estimate[index] = sample;
+    }
+  }
+  else
+  {
+    op->Min = (duration < op->Min) ? duration : op->Min;
+    op->Max = (duration > op->Max) ? duration : op->Max;
+
+    /* Exponentially weighted mean */
+    if (sample > op->Mean)
+    {
+      op->Mean += (sample - op->Mean) >> 3;
+    }
+    else
+    {
+      op->Mean -= (op->Mean - sample) >> 3;
+    }
+
+    /* Stochastic percentile estimates: step up by p, down by (100 - p), so
+       that each estimate settles where p% of the samples are below it */
+    for (index = 0U; index < MX25R3235F_PERCENTILE_NUMBER; index++)
+    {
+      step = (op->Estimate[index] >> 5) + (1UL << MX25R3235F_TIMING_SHIFT);
+      if (sample > op->Estimate[index])
+      {
+        step = (uint32_t)(((uint64_t)step * MX25R3235F_Percentile[index]) / 100U);
+        op->Estimate[index] = ((sample - op->Estimate[index]) > step) ? (op->Estimate[index] + step) : sample;
+      }
+      else if (sample < op->Estimate[index])
+      {
+        step = (uint32_t)(((uint64_t)step * (100U - MX25R3235F_Percentile[index])) / 100U);
+        op->Estimate[index] = ((op->Estimate[index] - sample) > step) ? (op->Estimate[index] - step) : sample;
+      }
+      else
+      {
+        /* Estimate matches the sample */
+      }
+    }
+  }
+
+  op->Count++;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Predicted duration of an operation
+  * @param  pTiming Timing statistics pointer
+  * @param  Operation Operation type
+  * @param  Percentile Percentile of the prediction
+  * @note   The datasheet maximum is returned until the operation is measured.
+  * @retval Duration in us
+  */
+uint32_t MX25R3235F_TimingPredict(const MX25R3235F_Timing_t *pTiming, MX25R3235F_Operation_t Operation,
+                                  MX25R3235F_Percentile_t Percentile)
+{
+  const MX25R3235F_OperationTiming_t *op;
+
+  if ((Operation >= MX25R3235F_OPERATION_NUMBER) || (Percentile >= MX25R3235F_PERCENTILE_NUMBER))
+  {
+    return 0U;
+  }
+
+  op = &pTiming->Operation[Operation];
+  if (op->Count == 0U)
+  {
+    return MX25R3235F_OperationMaxTime[Operation] * 1000U;
+  }
+
+  /* Round up to the us */
+  return (op->Estimate[Percentile] + (1UL << MX25R3235F_TIMING_SHIFT) - 1U) >> MX25R3235F_TIMING_SHIFT;
+}
+
+/**
+  * @brief  Predicted time left before the end of the current operation
+  * @param  pTiming Timing statistics pointer
+  * @param  Percentile Percentile of the prediction
+  * @note   Use it to sleep before polling the memory instead of polling for
+  *         the datasheet maximum duration.
+  * @retval Remaining time in us, 0 if the operation should be over
+  */
+uint32_t MX25R3235F_TimingRemaining(const MX25R3235F_Timing_t *pTiming, MX25R3235F_Percentile_t Percentile)
+{
+  uint32_t predicted;
+  uint32_t elapsed;
+
+  if (pTiming->Current >= MX25R3235F_OPERATION_NUMBER)
+  {
+    return 0U;
+  }
+
+  predicted = MX25R3235F_TimingPredict(pTiming, pTiming->Current, Percentile);
+  elapsed   = MX25R3235F_TimingGetTime() - pTiming->StartTime;
+
+  return (elapsed < predicted) ? (predicted - elapsed) : 0U;
+}
+
+/**
+  * @brief  Wait for the end of the current operation and measure it
+  * @param  Ctx Component object pointer
+  * @param  pTiming Timing statistics pointer
+  * @note   The end of the operation is detected by automatic polling of the
+  *         WIP bit, within the datasheet maximum duration of the operation.
+  * @retval error status
+  */
+int32_t MX25R3235F_TimingWait(XSPI_HandleTypeDef *Ctx, MX25R3235F_Timing_t *pTiming)
+{
+  if (pTiming->Current >= MX25R3235F_OPERATION_NUMBER)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_OperationMaxTime[pTiming->Current]) != MX25R3235F_OK)
+  {
+    pTiming->Current = MX25R3235F_OPERATION_NUMBER;
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_TimingStop(pTiming);
+}
+
+/**
+  * @brief  Time source of the operation timing statistics
+  * @note   This default implementation is based on the HAL tick and has a
+  *         1 ms resolution, too coarse for a page program (below 1 ms
+  *         typical) or a wake-up from deep power-down. Override it with a us
+  *         timer (cycle counter, timer...) to measure them, and set
+  *         MX25R3235F_TIME_RESOLUTION accordingly. The counter may wrap around.
+  * @retval Time in us
+  */
+__weak uint32_t MX25R3235F_TimingGetTime(void)
+{
+  return HAL_GetTick() * 1000U;
+}
+
+/* Trace Commands *************************************************************/
+/**
+  * @brief  Trace hook called for each read, program and erase command sent.
+  * @param  Ctx Component object pointer
+  * @param  pRecord Trace record, only valid during the call
+  * @note   Called when MX25R3235F_USE_TRACE is set, after the command was sent
+  *         successfully. Reads are reported per command: a chunked read
+  *         gives one record per chunk. This default implementation does
+  *         nothing, override it to store the records (binary records or a
+  *         text line per record) for an offline replay of the workload.
+  *         The records are timestamped in us with MX25R3235F_TimingGetTime().
+  * @retval None
+  */
+__weak void MX25R3235F_TraceCallback(XSPI_HandleTypeDef *Ctx, const MX25R3235F_TraceRecord_t *pRecord)
+{
+  /* Prevent unused argument(s) compilation warning */
+  (void)Ctx;
+  (void)pRecord;
+}
+
+/* Fault Injection Commands ***************************************************/
+/**
+  * @brief  Fault injection hook called once a program, erase or status
+  *         register write is started.
+  * @param  Ctx Component object pointer
+  * @param  Operation Operation in progress
+  * @param  Address Start address of the program or erase, 0 for a register write
+  * @note   Called when MX25R3235F_USE_FAULT_INJECTION is set, while the memory
+  *         is busy. An implementation waits for a random delay (shorter than
+  *         the typical duration of the operation) and returns 1 to cut the
+  *         operation: the driver then resets the memory, which aborts it and
+  *         leaves the cells partially programmed or erased as after a power
+  *         loss, and the interrupted call returns MX25R3235F_ERROR. When the
+  *         operation is already completed once the hook returns, it is not
+  *         cut and the call succeeds: a test application counts these missed
+  *         cuts to check that its delays actually cut the operations. The test
+  *         application remounts its storage from there and measures the time
+  *         to remount, the data lost and, with MX25R3235F_USE_TRACE, the bytes
+  *         read by the recovery scan. This default implementation never cuts.
+  * @retval 1 to cut the operation, 0 otherwise
+  */
+__weak uint32_t MX25R3235F_FaultCallback(XSPI_HandleTypeDef *Ctx, MX25R3235F_FaultOperation_t Operation, uint32_t Address)
+{
+  /* Prevent unused argument(s) compilation warning */
+  (void)Ctx;
+  (void)Operation;
+  (void)Address;
+
+  return 0U;
+}
+
+/* Zero-Copy Read Commands ****************************************************/
+/**
+  * @brief  Initialize a memory mapped window descriptor
+  * @param  pMap Memory mapped window pointer
+  * @param  pBase Address of the XSPI memory mapped window
+  * @param  Mode Interface mode used for the mapping and the indirect reads
+  * @retval error status
+  */
+int32_t MX25R3235F_MapInit(MX25R3235F_Map_t *pMap, const uint8_t *pBase, MX25R3235F_Interface_t Mode)
+{
+  pMap->pBase      = pBase;
+  pMap->Mode       = Mode;
+  pMap->Mapped     = 0U;
+  pMap->Generation = 0U;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Enable memory mapped mode and the zero-copy reads
+  * @param  Ctx Component object pointer
+  * @param  pMap Memory mapped window pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_MapEnable(XSPI_HandleTypeDef *Ctx, MX25R3235F_Map_t *pMap)
+{
+  if (MX25R3235F_EnableMemoryMappedMode(Ctx, pMap->Mode) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pMap->Mapped = 1U;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Disable memory mapped mode and invalidate the borrowed pointers
+  * @param  Ctx Component object pointer
+  * @param  pMap Memory mapped window pointer
+  * @note   Program and erase need indirect mode: calling this function first
+  *         increments the generation, so that readers holding a pointer into
+  *         the window can tell that the content may have changed.
+  *         The generation is only incremented here, not by the program and
+  *         erase functions: the invalidation covers the exits from memory
+  *         mapped mode done with this function, not those done through the
+  *         HAL or MX25R3235F_DisableMemoryMappedMode() directly.
+  * @retval error status
+  */
+int32_t MX25R3235F_MapDisable(XSPI_HandleTypeDef *Ctx, MX25R3235F_Map_t *pMap)
+{
+  pMap->Generation++;
+
+  if (pMap->Mapped != 0U)
+  {
+    pMap->Mapped = 0U;
+    if (MX25R3235F_DisableMemoryMappedMode(Ctx) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Get a read-only view of a memory area
+  * @param  Ctx Component object pointer
+  * @param  pMap Memory mapped window pointer
+  * @param  ReadAddr Read start address
+  * @param  Size Size of the area
+  * @param  pBuffer Buffer used when the memory is not mapped, may be NULL
+  * @param  ppData Returns the address of the data
+  * @param  pGeneration Returns the generation of the view, may be NULL
+  * @note   When mapped, the returned pointer is in the XSPI window and no data
+  *         is copied. Otherwise the area is read into pBuffer. A view from
+  *         the window stays valid while MX25R3235F_BorrowValid() returns 1,
+  *         as long as memory mapped mode is only left with MX25R3235F_MapDisable().
+  * @retval error status
+  */
+int32_t MX25R3235F_Borrow(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Map_t *pMap, uint32_t ReadAddr, uint32_t Size,
+                          uint8_t *pBuffer, const uint8_t **ppData, uint32_t *pGeneration)
+{
+  if ((ReadAddr >= MX25R3235F_FLASH_SIZE) || (Size > (MX25R3235F_FLASH_SIZE - ReadAddr)))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (pMap->Mapped != 0U)
+  {
+    *ppData = &pMap->pBase[ReadAddr];
+  }
+  else if ((pBuffer != NULL) && (MX25R3235F_Read(Ctx, pMap->Mode, pBuffer, ReadAddr, Size) == MX25R3235F_OK))
+  {
+    *ppData = pBuffer;
+  }
+  else
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (pGeneration != NULL)
+  {
+    *pGeneration = pMap->Generation;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Check that a view returned by MX25R3235F_Borrow() is still valid
+  * @param  pMap Memory mapped window pointer
+  * @param  Generation Generation returned with the view
+  * @retval 1 if the memory was not remapped since, 0 otherwise
+  */
+uint32_t MX25R3235F_BorrowValid(const MX25R3235F_Map_t *pMap, uint32_t Generation)
+{
+  return ((pMap->Mapped != 0U) && (pMap->Generation == Generation)) ? 1U : 0U;
+}
+
+/* Read Calibration Commands **************************************************/
+/**
+  * @brief  Find the fastest read configuration of each interface mode
+  * @param  Ctx Component object pointer
+  * @param  pCalibration Returns the calibration result
+  * @param  PatternAddress Address of a 4K sector reserved for the pattern (a
+  *         4K sector of each device with MX25R3235F_DUAL_FLASH set)
+  * @param  ClockFrequency XSPI kernel clock frequency (Hz)
+  * @note   The XSPI must be initialized with a known good clock prescaler
+  *         (the baseline) and not be in memory mapped mode. The pattern is
+  *         written once: the sector is only erased and programmed when it
+  *         does not hold it. For each mode, the prescaler is decreased from
+  *         the baseline, with and without half-cycle sample shifting, while
+  *         the pattern reads back correctly MX25R3235F_CAL_REPEAT times in a
+  *         row and the clock stays within the fMAX of the current power mode
+  *         (configuration register 2 L/H switch). When the sweep stops on a
+  *         failure, the result is backed off by MX25R3235F_CAL_GUARD_STEPS
+  *         prescaler steps (up to the baseline) and checked again, so that
+  *         it does not sit on the edge of the passing window. The dummy
+  *         cycles are not swept: they are fixed by the read commands of the
+  *         MX25R3235F. A calibration done in high performance mode must be
+  *         done again for the low power mode. With MX25R3235F_FIXED_MODE,
+  *         only the fixed read mode is calibrated.
+  *         The XSPI is set back to the baseline at the end. The result can be
+  *         saved by the application and applied at each boot with
+  *         MX25R3235F_CalibrationApply().
+  * @retval error status
+  */
+int32_t MX25R3235F_Calibrate(XSPI_HandleTypeDef *Ctx, MX25R3235F_Calibration_t *pCalibration, uint32_t PatternAddress,
+                             uint32_t ClockFrequency)
+{
+  uint8_t  buffer[MX25R3235F_CAL_PATTERN_SIZE];
+  uint32_t baseline_prescaler = Ctx->Init.ClockPrescaler;
+  uint32_t baseline_shift = Ctx->Init.SampleShifting;
+  uint32_t max_frequency;
+  uint32_t prescaler;
+  uint32_t passed;
+  uint32_t mode;
+  uint32_t index;
+  uint8_t  reg;
+  int32_t  ret = MX25R3235F_OK;
+
+  (void)memset(pCalibration, 0, sizeof(MX25R3235F_Calibration_t));
+
+  /* The sector erase covers one 4K sector of each device */
+  if ((PatternAddress % (MX25R3235F_SECTOR_4K * MX25R3235F_DEVICE_NUMBER)) != 0U)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_ReadCfg2Register(Ctx, &reg) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+  max_frequency = ((reg & MX25R3235F_CR2_LH_SWITCH) != 0U) ? MX25R3235F_HIGH_PERF_MAX_FREQ :
+                  MX25R3235F_LOW_POWER_MAX_FREQ;
+
+  /* Write the pattern once, at the baseline */
+  if (MX25R3235F_CalCheck(Ctx, MX25R3235F_SPI_MODE, PatternAddress, buffer) != MX25R3235F_OK)
+  {
+    for (index = 0U; index < MX25R3235F_CAL_PATTERN_SIZE; index++)
+    {
+      buffer[index] = MX25R3235F_CalPattern(index);
+    }
+
+    if ((MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK) ||
+        (MX25R3235F_BlockErase(Ctx, PatternAddress, MX25R3235F_ERASE_4K) != MX25R3235F_OK) ||
+        (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK) ||
+        (MX25R3235F_Write(Ctx, MX25R3235F_SPI_MODE, buffer, PatternAddress, MX25R3235F_CAL_PATTERN_SIZE,
+                          MX25R3235F_VERIFY_READBACK, NULL) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+  }
+
+  for (mode = 0U; (mode < MX25R3235F_INTERFACE_NUMBER) && (ret == MX25R3235F_OK); mode++)
+  {
+    /* Only the read mode the driver is built for can be calibrated */
+    if (mode != (uint32_t)MX25R3235F_READ_MODE(mode))
+    {
+      continue;
+    }
+
+    /* Stop at fMAX or at the first prescaler failing with both sample shiftings */
+    prescaler = baseline_prescaler;
+    do
+    {
+      if ((ClockFrequency / (prescaler + 1U)) > max_frequency)
+      {
+        break;
+      }
+
+      ret = MX25R3235F_CalStep(Ctx, pCalibration, (MX25R3235F_Interface_t)mode, PatternAddress, buffer, prescaler,
+                               &passed);
+    } while ((ret == MX25R3235F_OK) && (passed != 0U) && (prescaler-- != 0U));
+
+    /* Guard band: back off from the failure, the result must pass again */
+    if ((ret == MX25R3235F_OK) && (passed == 0U) && ((pCalibration->Valid & (1UL << mode)) != 0U))
+    {
+      prescaler = pCalibration->Prescaler[mode] + MX25R3235F_CAL_GUARD_STEPS;
+      prescaler = (prescaler > baseline_prescaler) ? baseline_prescaler : prescaler;
+      pCalibration->Valid &= ~(1UL << mode);
+      ret = MX25R3235F_CalStep(Ctx, pCalibration, (MX25R3235F_Interface_t)mode, PatternAddress, buffer, prescaler,
+                               &passed);
+    }
+  }
+
+  if (MX25R3235F_CalSet(Ctx, baseline_prescaler, baseline_shift) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return ((pCalibration->Valid & (1UL << (uint32_t)MX25R3235F_READ_MODE(MX25R3235F_SPI_MODE))) != 0U) ?
+         ret : MX25R3235F_ERROR;
+}
+
+/**
+  * @brief  Apply the calibrated read configuration of an interface mode
+  * @param  Ctx Component object pointer
+  * @param  pCalibration Calibration result pointer
+  * @param  Mode Interface mode used for the reads
+  * @retval error status
+  */
+int32_t MX25R3235F_CalibrationApply(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Calibration_t *pCalibration,
+                                    MX25R3235F_Interface_t Mode)
+{
+  if (((uint32_t)Mode >= MX25R3235F_INTERFACE_NUMBER) || ((pCalibration->Valid & (1UL << (uint32_t)Mode)) == 0U))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_CalSet(Ctx, pCalibration->Prescaler[Mode], pCalibration->SampleShifting[Mode]);
+}
+
+/* Copy Commands **************************************************************/
+/**
+  * @brief  Copy a memory area to another place of the memory
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @param  SrcAddr Source address
+  * @param  DstAddr Destination address
+  * @param  Size Number of bytes to copy
+  * @param  pBuffer Pointer to the working buffer
+  * @param  BufferSize Size of the working buffer, at least one page
+  * @note   The destination sectors fully covered by the area are erased
+  *         first. In a sector only partly covered, the data around the area
+  *         is kept and the covered part must already be erased. The source
+  *         must not overlap the destination sectors, and both areas must
+  *         lie within the memory.
+  *         The source is read a whole buffer at a time, cut on destination
+  *         page boundaries, and the pages left erased (all 0xFF) are not
+  *         programmed. A read cannot run while the memory programs, so the
+  *         larger the buffer, the lower the command overhead.
+  * @note   With MX25R3235F_DUAL_FLASH set, the addresses and the size must
+  *         be even: each byte pair is shared by the two devices.
+  * @retval error status
+  */
+int32_t MX25R3235F_Copy(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t SrcAddr, uint32_t DstAddr,
+                        uint32_t Size, uint8_t *pBuffer, uint32_t BufferSize)
+{
+  uint32_t flash_size = MX25R3235F_FLASH_SIZE * MX25R3235F_DEVICE_NUMBER;
+  uint32_t sector_size = MX25R3235F_SECTOR_4K * MX25R3235F_DEVICE_NUMBER;
+  uint32_t usable = BufferSize - (BufferSize % MX25R3235F_PROG_PAGE_SIZE);
+  uint32_t erase_start = DstAddr - (DstAddr % sector_size);
+  uint32_t erase_end = (DstAddr + Size + sector_size - 1U) - ((DstAddr + Size + sector_size - 1U) % sector_size);
+  uint32_t sector;
+  uint32_t start;
+  uint32_t stop;
+  uint32_t offset;
+  uint32_t chunk;
+  uint32_t length;
+  uint32_t index;
+
+  if ((Size == 0U) || (usable == 0U) || (((SrcAddr | DstAddr | Size) % MX25R3235F_DEVICE_NUMBER) != 0U) ||
+      (SrcAddr >= flash_size) || (Size > (flash_size - SrcAddr)) ||
+      (DstAddr >= flash_size) || (Size > (flash_size - DstAddr)) ||
+      ((SrcAddr < erase_end) && ((SrcAddr + Size) > erase_start)))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Prepare the destination */
+  for (sector = erase_start; sector < erase_end; sector += sector_size)
+  {
+    start = (sector < DstAddr) ? DstAddr : sector;
+    stop  = ((sector + sector_size) > (DstAddr + Size)) ? (DstAddr + Size) : (sector + sector_size);
+
+    if ((start == sector) && (stop == (sector + sector_size)))
+    {
+      if ((MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK) ||
+          (MX25R3235F_BlockErase(Ctx, sector, MX25R3235F_ERASE_4K) != MX25R3235F_OK) ||
+          (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK))
+      {
+        return MX25R3235F_ERROR;
+      }
+      continue;
+    }
+
+    for (offset = start; offset < stop; offset += chunk)
+    {
+      chunk = ((stop - offset) < usable) ? (stop - offset) : usable;
+      if (MX25R3235F_Read(Ctx, Mode, pBuffer, offset, chunk) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      index = 0U;
+      while ((index < chunk) && (pBuffer[index] == 0xFFU))
+      {
+        index++;
+      }
+
+      if (index != chunk)
+      {
+        return MX25R3235F_ERROR;
+      }
+    }
+  }
+
+  /* Copy a buffer at a time */
+  for (offset = 0U; offset < Size; offset += chunk)
+  {
+    chunk = Size - offset;
+    if (chunk >= usable)
+    {
+      /* End on a destination page boundary */
+      chunk = usable - ((DstAddr + offset + usable) % MX25R3235F_PROG_PAGE_SIZE);
+    }
+
+    if (MX25R3235F_Read(Ctx, Mode, pBuffer, SrcAddr + offset, chunk) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    for (start = 0U; start < chunk; start += length)
+    {
+      length = MX25R3235F_PROG_PAGE_SIZE - ((DstAddr + offset + start) % MX25R3235F_PROG_PAGE_SIZE);
+      if (length > (chunk - start))
+      {
+        length = chunk - start;
+      }
+
+      /* Erased content does not need programming */
+      index = 0U;
+      while ((index < length) && (pBuffer[start + index] == 0xFFU))
+      {
+        index++;
+      }
+
+      if ((index != length) &&
+          (MX25R3235F_Write(Ctx, Mode, &pBuffer[start], DstAddr + offset + start, length,
+                            MX25R3235F_VERIFY_FAIL_FLAG, NULL) != MX25R3235F_OK))
+      {
+        return MX25R3235F_ERROR;
+      }
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
+/* Instance Commands **********************************************************/
+/**
+  * @brief  Initialize the object of a memory instance
+  * @param  pObj Instance object pointer
+  * @param  Ctx XSPI handle the memory is connected to
+  * @param  Mode Interface mode of the instance
+  * @param  pMapBase XSPI memory mapped window of the instance
+  * @param  IdleTime Idle time in ms before deep power-down, 0 to disable
+  * @note   The object bundles the state of a memory (handle, mode, power
+  *         and mapping state, read in flight) for the non-blocking read:
+  *         with MX25R3235F_ReadStart() and MX25R3235F_ReadComplete(), the
+  *         reads of memories on separate XSPI controllers overlap from a
+  *         single thread. The other commands do not take the object: they
+  *         are called with its members (pObj->Ctx, pObj->Mode, &pObj->Power,
+  *         &pObj->Map). The hooks (MX25R3235F_TraceCallback...) tell the
+  *         instances apart by their XSPI handle.
+  * @retval error status
+  */
+int32_t MX25R3235F_ObjectInit(MX25R3235F_Object_t *pObj, XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode,
+                              const uint8_t *pMapBase, uint32_t IdleTime)
+{
+  if ((MX25R3235F_PowerInit(&pObj->Power, IdleTime) != MX25R3235F_OK) ||
+      (MX25R3235F_MapInit(&pObj->Map, pMapBase, Mode) != MX25R3235F_OK))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pObj->Ctx           = Ctx;
+  pObj->Mode          = Mode;
+  pObj->ReadSize      = 0U;
+  pObj->IsInitialized = 1U;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Start a read on a memory instance without waiting for its end
+  * @param  pObj Instance object pointer
+  * @param  pData Pointer to data to be read, valid until the read completes
+  * @param  ReadAddr Read start address
+  * @param  Size Size of data to read
+  * @note   The memory is woken up from deep power-down if needed. With
+  *         MX25R3235F_USE_DMA set, the data is received by DMA and the call
+  *         returns at once; otherwise the read completes before the return.
+  *         One read can be in flight per instance.
+  * @retval error status
+  */
+int32_t MX25R3235F_ReadStart(MX25R3235F_Object_t *pObj, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+{
+  if ((pObj->IsInitialized == 0U) || (pObj->ReadSize != 0U) || (pObj->Map.Mapped != 0U) || (Size == 0U))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_PowerWakeUp(pObj->Ctx, &pObj->Power) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Do not leave a configured command pending on failure */
+#if (MX25R3235F_USE_DMA == 1U)
+  if ((MX25R3235F_ReadCommand(pObj->Ctx, pObj->Mode, ReadAddr, Size) != MX25R3235F_OK) ||
+      (HAL_XSPI_Receive_DMA(pObj->Ctx, pData) != HAL_OK))
+#else
+  if ((MX25R3235F_ReadCommand(pObj->Ctx, pObj->Mode, ReadAddr, Size) != MX25R3235F_OK) ||
+      (HAL_XSPI_Receive(pObj->Ctx, pData, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK))
+#endif /* MX25R3235F_USE_DMA */
+  {
+    (void)HAL_XSPI_Abort(pObj->Ctx);
+    return MX25R3235F_ERROR;
+  }
+
+  pObj->ReadSize = Size;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Check the end of the read in flight on a memory instance
+  * @param  pObj Instance object pointer
+  * @param  pDone Returns 1 when no read is in flight anymore, 0 otherwise
+  * @note   A failed read is reported done with an error: the content of its
+  *         data buffer is not valid.
+  * @retval error status
+  */
+int32_t MX25R3235F_ReadComplete(MX25R3235F_Object_t *pObj, uint32_t *pDone)
+{
+  *pDone = 1U;
+
+  if (pObj->ReadSize != 0U)
+  {
+    if (HAL_XSPI_GetState(pObj->Ctx) != HAL_XSPI_STATE_READY)
+    {
+      *pDone = 0U;
+    }
+    else
+    {
+      pObj->ReadSize = 0U;
+
+      /* A transfer or DMA error also ends in the ready state */
+      if (HAL_XSPI_GetError(pObj->Ctx) != HAL_XSPI_ERROR_NONE)
+      {
+        return MX25R3235F_ERROR;
+      }
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Private_Functions MX25R3235F Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Set the instruction, address/data lines and dummy cycles of the
+  *         read command for the selected interface mode.
+  * @param  Mode Interface mode, ignored when MX25R3235F_FIXED_MODE is defined
+  * @param  pCommand Command to complete
+  * @retval XSPI memory status
+  */
+static int32_t MX25R3235F_ReadConfig(MX25R3235F_Interface_t Mode, XSPI_RegularCmdTypeDef *pCommand)
+{
+#if defined(MX25R3235F_FIXED_MODE)
+  (void)Mode;
+
+  pCommand->Instruction = MX25R3235F_FIXED_READ_CMD;
+  pCommand->AddressMode = MX25R3235F_FIXED_READ_ADDRESS_MODE;
+  pCommand->DataMode    = MX25R3235F_FIXED_READ_DATA_MODE;
+  pCommand->DummyCycles = MX25R3235F_FIXED_READ_DUMMY_CYCLES;
+#else
+  switch(Mode)
+  {
+  case MX25R3235F_SPI_MODE :
+    pCommand->Instruction = MX25R3235F_FAST_READ_CMD;
+    pCommand->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+    pCommand->DataMode    = HAL_XSPI_DATA_1_LINE;
+    pCommand->DummyCycles = DUMMY_CYCLES_READ;
+    break;
+
+  case MX25R3235F_DUAL_OUT_MODE :
+    pCommand->Instruction = MX25R3235F_DUAL_OUT_READ_CMD;
+    pCommand->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+    pCommand->DataMode    = HAL_XSPI_DATA_2_LINES;
+    pCommand->DummyCycles = DUMMY_CYCLES_READ;
+    break;
+
+  case MX25R3235F_DUAL_IO_MODE :
+    pCommand->Instruction = MX25R3235F_DUAL_INOUT_READ_CMD;
+    pCommand->AddressMode = HAL_XSPI_ADDRESS_2_LINES;
+    pCommand->DataMode    = HAL_XSPI_DATA_2_LINES;
+    pCommand->DummyCycles = DUMMY_CYCLES_READ_DUAL;
+    break;
+
+  case MX25R3235F_QUAD_OUT_MODE :
+    pCommand->Instruction = MX25R3235F_QUAD_OUT_READ_CMD;
+    pCommand->AddressMode = HAL_XSPI_ADDRESS_1_LINE;
+    pCommand->DataMode    = HAL_XSPI_DATA_4_LINES;
+    pCommand->DummyCycles = DUMMY_CYCLES_READ;
+    break;
+
+  case MX25R3235F_QUAD_IO_MODE :
+    pCommand->Instruction = MX25R3235F_QUAD_INOUT_READ_CMD;
+    pCommand->AddressMode = HAL_XSPI_ADDRESS_4_LINES;
+    pCommand->DataMode    = HAL_XSPI_DATA_4_LINES;
+    pCommand->DummyCycles = DUMMY_CYCLES_READ_QUAD;
+    break;
+
+  default :
+    return MX25R3235F_ERROR;
+  }
+#endif /* MX25R3235F_FIXED_MODE */
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Send the read command for the selected interface mode.
+  *         SPI/DUAL_OUT/DUAL_INOUT/QUAD_OUT/QUAD_INOUT/; 1-1-1/1-1-2/1-2-2/1-1-4/1-4-4
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  ReadAddr Read start address
+  * @param  Size Size of data to read
+  * @retval XSPI memory status
+  */
+static int32_t MX25R3235F_ReadCommand(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t ReadAddr, uint32_t Size)
+{
+  XSPI_RegularCmdTypeDef sCommand = {0};
+
+  /* Initialize the read command */
+  sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_1_LINE;
+  sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressWidth       = HAL_XSPI_ADDRESS_24_BITS;
+  sCommand.Address            = ReadAddr;
+  sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
+  sCommand.DataLength         = Size;
+  sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
+
+  if (MX25R3235F_ReadConfig(Mode, &sCommand) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Send the command */
+  if (HAL_XSPI_Command(Ctx, &sCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+#if (MX25R3235F_USE_TRACE == 1U)
+  MX25R3235F_TraceEvent(Ctx, MX25R3235F_TRACE_READ, MX25R3235F_READ_MODE(Mode), ReadAddr, Size);
+#endif /* MX25R3235F_USE_TRACE */
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Read stream callback folding a chunk into a CRC-32.
+  * @param  pArg Pointer to the CRC value
+  * @param  pData Pointer to the chunk
+  * @param  Size Size of the chunk
+  * @retval None
+  */
+static void MX25R3235F_CRC32Callback(void *pArg, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t *crc = (uint32_t *)pArg;
+
+  *crc = MX25R3235F_CRC32(*crc, pData, Size);
+}
+
+/**
+  * @brief  Find the first difference between two buffers.
+  * @param  pExpected Pointer to the reference data
+  * @param  pActual Pointer to the data to check, 32-bit aligned
+  * @param  Size Size of data to compare
+  * @note   Word compare is used when the reference data is 32-bit aligned too.
+  * @retval Offset of the first different byte, Size when buffers are identical
+  */
+static uint32_t MX25R3235F_Compare(const uint8_t *pExpected, const uint8_t *pActual, uint32_t Size)
+{
+  const uint32_t *expected_word = (const uint32_t *)(const void *)pExpected;
+  const uint32_t *actual_word   = (const uint32_t *)(const void *)pActual;
+  uint32_t offset = 0U;
+
+  if (((uintptr_t)pExpected & 3U) == 0U)
+  {
+    while (((Size - offset) >= 4U) && (expected_word[offset / 4U] == actual_word[offset / 4U]))
+    {
+      offset += 4U;
+    }
+  }
+
+  while ((offset < Size) && (pExpected[offset] == pActual[offset]))
+  {
+    offset++;
+  }
+
+  return offset;
+}
+
+/**
+  * @brief  Poll the memory with Read ID until it answers.
+  * @param  Ctx Component object pointer
+  * @param  Timeout Timeout in us, extended by MX25R3235F_TIME_RESOLUTION
+  * @retval error status
+  */
+static int32_t MX25R3235F_PollID(XSPI_HandleTypeDef *Ctx, uint32_t Timeout)
+{
+  uint8_t  id[3];
+  uint32_t timestart = MX25R3235F_TimingGetTime();
+
+  do
+  {
+    if (MX25R3235F_ReadID(Ctx, id) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if (id[0] == MX25R3235F_MANUFACTURER_ID)
+    {
+      return MX25R3235F_OK;
+    }
+  } while ((MX25R3235F_TimingGetTime() - timestart) <= (Timeout + MX25R3235F_TIME_RESOLUTION));
+
+  return MX25R3235F_ERROR;
+}
+
+/**
+  * @brief  Load the secured OTP area and the security register in the cache.
+  * @param  Ctx Component object pointer
+  * @param  pOTP Secured OTP cache pointer
+  * @retval error status
+  */
+static int32_t MX25R3235F_OTPLoad(XSPI_HandleTypeDef *Ctx, MX25R3235F_OTP_t *pOTP)
+{
+  int32_t ret;
+
+  if (MX25R3235F_ReadSecurityRegister(Ctx, &pOTP->SecurityReg) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_EnterSecuredOTP(Ctx) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  ret = MX25R3235F_Read(Ctx, MX25R3235F_SPI_MODE, pOTP->Data, 0U, MX25R3235F_OTP_SIZE);
+
+  /* Always leave the secured OTP mode */
+  if (MX25R3235F_ExitSecuredOTP(Ctx) != MX25R3235F_OK)
+  {
+    ret = MX25R3235F_ERROR;
+  }
+
+  pOTP->Loaded = (ret == MX25R3235F_OK) ? 1U : 0U;
+
+  return ret;
+}
+
+/**
+  * @brief  Get the area protected by a BP/TB setting.
+  * @param  BP Block protect value (0 to 15)
+  * @param  TB Top/bottom bit (0 or MX25R3235F_CR1_TB)
+  * @param  pStart Start address of the protected area
+  * @param  pSize Size of the protected area
+  * @retval None
+  */
+static void MX25R3235F_ProtectArea(uint8_t BP, uint8_t TB, uint32_t *pStart, uint32_t *pSize)
+{
+  /* BP=1 protects one 64K block, each increment doubles the area */
+  if (BP == 0U)
+  {
+    *pSize = 0U;
+  }
+  else if ((MX25R3235F_BLOCK_64K << (BP - 1U)) >= MX25R3235F_FLASH_SIZE)
+  {
+    *pSize = MX25R3235F_FLASH_SIZE;
+  }
+  else
+  {
+    *pSize = MX25R3235F_BLOCK_64K << (BP - 1U);
+  }
+
+  *pStart = (TB != 0U) ? 0U : (MX25R3235F_FLASH_SIZE - *pSize);
+}
+
+/**
+  * @brief  Write the block protection bits from the cached registers.
+  * @param  Ctx Component object pointer
+  * @param  pProtect Block protection cache pointer
+  * @param  BP Block protect bits, in status register position
+  * @param  TB Top/bottom bit, in configuration register 1 position
+  * @retval error status
+  */
+static int32_t MX25R3235F_ProtectWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect, uint8_t BP, uint8_t TB)
+{
+  XSPI_RegularCmdTypeDef sCommand = {0};
+  uint8_t reg[3];
+
+  reg[0] = (pProtect->Reg[0] & (uint8_t)~(MX25R3235F_SR_BP | MX25R3235F_SR_WIP | MX25R3235F_SR_WEL)) | BP;
+  reg[1] = (pProtect->Reg[1] & (uint8_t)~MX25R3235F_CR1_TB) | TB;
+  reg[2] = pProtect->Reg[2];
+
+  if (MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Initialize the writing of status and configuration registers */
+  sCommand.InstructionMode    = HAL_XSPI_INSTRUCTION_1_LINE;
+  sCommand.Instruction        = MX25R3235F_WRITE_STATUS_CFG_REG_CMD;
+  sCommand.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+  sCommand.AddressMode        = HAL_XSPI_ADDRESS_NONE;
+  sCommand.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
+  sCommand.DataMode           = HAL_XSPI_DATA_1_LINE;
+  sCommand.DummyCycles        = 0U;
+  sCommand.DataLength         = 3U;
+  sCommand.DataDTRMode        = HAL_XSPI_DATA_DTR_DISABLE;
+
+  if (MX25R3235F_RegWrite(Ctx, &sCommand, reg) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_WRITE_REG_MAX_TIME) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pProtect->Reg[0] = reg[0];
+  pProtect->Reg[1] = reg[1];
+
+  return MX25R3235F_OK;
+}
+
+#if (MX25R3235F_USE_TRACE == 1U)
+/**
+  * @brief  Build a trace record and pass it to the trace hook.
+  * @param  Ctx Component object pointer
+  * @param  Operation Operation type
+  * @param  Mode Interface mode of the command
+  * @param  Address Start address of the operation
+  * @param  Size Size of the operation
+  * @retval None
+  */
+static void MX25R3235F_TraceEvent(XSPI_HandleTypeDef *Ctx, MX25R3235F_TraceOperation_t Operation,
+                                  MX25R3235F_Interface_t Mode, uint32_t Address, uint32_t Size)
+{
+  MX25R3235F_TraceRecord_t record;
+
+  record.Timestamp = MX25R3235F_TimingGetTime();
+  record.Address   = Address;
+  record.Size      = Size;
+  record.Operation = (uint32_t)Operation;
+  record.Mode      = (uint32_t)Mode;
+
+  MX25R3235F_TraceCallback(Ctx, &record);
+}
+#endif /* MX25R3235F_USE_TRACE */
+
+/**
+  * @brief  Send a register read command and receive the register bytes.
+  * @param  Ctx Component object pointer
+  * @param  pCommand Command, DataLength set to the size of the register
+  * @param  pValue Register value pointer
+  * @note   In dual-flash mode each byte is received from each device in turn:
+  *         a bit is reported set when it is set in any of the devices.
+  * @retval error status
+  */
+static int32_t MX25R3235F_RegRead(XSPI_HandleTypeDef *Ctx, XSPI_RegularCmdTypeDef *pCommand, uint8_t *pValue)
+{
+  uint8_t  data[MX25R3235F_REG_MAX_SIZE * MX25R3235F_DEVICE_NUMBER];
+  uint32_t size = pCommand->DataLength;
+  uint32_t index;
+  uint32_t device;
+
+  pCommand->DataLength = size * MX25R3235F_DEVICE_NUMBER;
+
+  if (HAL_XSPI_Command(Ctx, pCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (HAL_XSPI_Receive(Ctx, data, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  for (index = 0U; index < size; index++)
+  {
+    pValue[index] = 0U;
+    for (device = 0U; device < MX25R3235F_DEVICE_NUMBER; device++)
+    {
+      pValue[index] |= data[(index * MX25R3235F_DEVICE_NUMBER) + device];
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Send a register write command and transmit the register bytes.
+  * @param  Ctx Component object pointer
+  * @param  pCommand Command, DataLength set to the size of the register
+  * @param  pValue Register value pointer
+  * @note   In dual-flash mode each byte is sent to each device in turn, so
+  *         that both devices get the same register value.
+  * @retval error status
+  */
+static int32_t MX25R3235F_RegWrite(XSPI_HandleTypeDef *Ctx, XSPI_RegularCmdTypeDef *pCommand, const uint8_t *pValue)
+{
+  uint8_t  data[MX25R3235F_REG_MAX_SIZE * MX25R3235F_DEVICE_NUMBER];
+  uint32_t size = pCommand->DataLength;
+  uint32_t index;
+  uint32_t device;
+
+  for (index = 0U; index < size; index++)
+  {
+    for (device = 0U; device < MX25R3235F_DEVICE_NUMBER; device++)
+    {
+      data[(index * MX25R3235F_DEVICE_NUMBER) + device] = pValue[index];
+    }
+  }
+
+  pCommand->DataLength = size * MX25R3235F_DEVICE_NUMBER;
+
+  if (HAL_XSPI_Command(Ctx, pCommand, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (HAL_XSPI_Transmit(Ctx, data, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+#if (MX25R3235F_USE_FAULT_INJECTION == 1U)
+  if ((pCommand->Instruction == MX25R3235F_WRITE_STATUS_CFG_REG_CMD) &&
+      (MX25R3235F_FaultPoint(Ctx, MX25R3235F_FAULT_WRITE_REG, 0U) != MX25R3235F_OK))
+  {
+    return MX25R3235F_ERROR;
+  }
+#endif /* MX25R3235F_USE_FAULT_INJECTION */
+
+  return MX25R3235F_OK;
+}
+
+#if (MX25R3235F_USE_FAULT_INJECTION == 1U)
+/**
+  * @brief  Ask the fault injection hook and cut the operation in progress.
+  * @param  Ctx Component object pointer
+  * @param  Operation Operation in progress
+  * @param  Address Start address of the operation
+  * @note   The operation is cut with the software reset of MX25R3235F_Recover().
+  *         An operation already completed when the hook returns is not cut.
+  * @retval MX25R3235F_ERROR when the operation was cut, error status otherwise
+  */
+static int32_t MX25R3235F_FaultPoint(XSPI_HandleTypeDef *Ctx, MX25R3235F_FaultOperation_t Operation, uint32_t Address)
+{
+  uint8_t reg;
+
+  if (MX25R3235F_FaultCallback(Ctx, Operation, Address) == 0U)
+  {
+    return MX25R3235F_OK;
+  }
+
+  /* The cut came too late: report the operation as completed */
+  if (MX25R3235F_ReadStatusRegister(Ctx, &reg) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+  if ((reg & MX25R3235F_SR_WIP) == 0U)
+  {
+    return MX25R3235F_OK;
+  }
+
+  (void)MX25R3235F_Recover(Ctx);
+
+  return MX25R3235F_ERROR;
+}
+#endif /* MX25R3235F_USE_FAULT_INJECTION */
+
+/**
+  * @brief  Byte of the read calibration pattern.
+  * @param  Index Byte index
+  * @note   Alternating bits on all the data lines, with a varying value so
+  *         that a shifted sampling does not read a valid pattern.
+  * @retval Pattern byte
+  */
+static uint8_t MX25R3235F_CalPattern(uint32_t Index)
+{
+  return (uint8_t)((Index * 0x6DU) ^ (((Index & 1U) != 0U) ? 0xA5U : 0x5AU));
+}
+
+/**
+  * @brief  Set the XSPI clock prescaler and sample shifting.
+  * @param  Ctx Component object pointer
+  * @param  Prescaler Clock prescaler
+  * @param  SampleShifting HAL_XSPI_SAMPLE_SHIFT_NONE or HAL_XSPI_SAMPLE_SHIFT_HALFCYCLE
+  * @note   The XSPI is initialized again only when the setting changes.
+  * @retval error status
+  */
+static int32_t MX25R3235F_CalSet(XSPI_HandleTypeDef *Ctx, uint32_t Prescaler, uint32_t SampleShifting)
+{
+  if ((Ctx->Init.ClockPrescaler == Prescaler) && (Ctx->Init.SampleShifting == SampleShifting))
+  {
+    return MX25R3235F_OK;
+  }
+
+  if (HAL_XSPI_DeInit(Ctx) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  Ctx->Init.ClockPrescaler = Prescaler;
+  Ctx->Init.SampleShifting = SampleShifting;
+
+  if (HAL_XSPI_Init(Ctx) != HAL_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Check the read calibration pattern with the current configuration.
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  Address Pattern address
+  * @param  pBuffer Working buffer of MX25R3235F_CAL_PATTERN_SIZE bytes
+  * @retval MX25R3235F_OK when all the reads match
+  */
+static int32_t MX25R3235F_CalCheck(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t Address,
+                                   uint8_t *pBuffer)
+{
+  uint32_t repeat;
+  uint32_t index;
+
+  for (repeat = 0U; repeat < MX25R3235F_CAL_REPEAT; repeat++)
+  {
+    if (MX25R3235F_Read(Ctx, Mode, pBuffer, Address, MX25R3235F_CAL_PATTERN_SIZE) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    for (index = 0U; index < MX25R3235F_CAL_PATTERN_SIZE; index++)
+    {
+      if (pBuffer[index] != MX25R3235F_CalPattern(index))
+      {
+        return MX25R3235F_ERROR;
+      }
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Check a calibration prescaler with and without sample shifting.
+  * @param  Ctx Component object pointer
+  * @param  pCalibration Calibration result, updated when the prescaler passes
+  * @param  Mode Interface mode
+  * @param  Address Pattern address
+  * @param  pBuffer Working buffer of MX25R3235F_CAL_PATTERN_SIZE bytes
+  * @param  Prescaler XSPI clock prescaler
+  * @param  pPassed Returns 1 when the pattern read back correctly, 0 otherwise
+  * @retval error status
+  */
+static int32_t MX25R3235F_CalStep(XSPI_HandleTypeDef *Ctx, MX25R3235F_Calibration_t *pCalibration,
+                                  MX25R3235F_Interface_t Mode, uint32_t Address, uint8_t *pBuffer,
+                                  uint32_t Prescaler, uint32_t *pPassed)
+{
+  static const uint32_t shift[2] = {HAL_XSPI_SAMPLE_SHIFT_NONE, HAL_XSPI_SAMPLE_SHIFT_HALFCYCLE};
+  uint32_t index;
+
+  *pPassed = 0U;
+  for (index = 0U; (index < 2U) && (*pPassed == 0U); index++)
+  {
+    if (MX25R3235F_CalSet(Ctx, Prescaler, shift[index]) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if (MX25R3235F_CalCheck(Ctx, Mode, Address, pBuffer) == MX25R3235F_OK)
+    {
+      pCalibration->Prescaler[Mode]      = Prescaler;
+      pCalibration->SampleShifting[Mode] = shift[index];
+      pCalibration->Valid               |= (1UL << (uint32_t)Mode);
+      *pPassed = 1U;
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
 /**
   * @}
   */
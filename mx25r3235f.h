@@ -27,6 +27,34 @@
 /* Includes ------------------------------------------------------------------*/
 #include "mx25r3235f_conf.h"
 
+/* Values of MX25R3235F_FIXED_MODE, same order as MX25R3235F_Interface_t ----*/
+#define MX25R3235F_FIXED_SPI                            0U
+#define MX25R3235F_FIXED_DUAL_OUT                       1U
+#define MX25R3235F_FIXED_DUAL_IO                        2U
+#define MX25R3235F_FIXED_QUAD_OUT                       3U
+#define MX25R3235F_FIXED_QUAD_IO                        4U
+
+/* Default configuration if not set in mx25r3235f_conf.h ---------------------*/
+#ifndef MX25R3235F_USE_DMA
+#define MX25R3235F_USE_DMA                              0U   /* Chunked reads use DMA double buffering */
+#endif
+
+#ifndef MX25R3235F_DUAL_FLASH
+#define MX25R3235F_DUAL_FLASH                           0U   /* Two devices in XSPI dual-memory mode */
+#endif
+
+#ifndef MX25R3235F_USE_TRACE
+#define MX25R3235F_USE_TRACE                            0U   /* Read/program/erase commands reported to MX25R3235F_TraceCallback */
+#endif
+
+#ifndef MX25R3235F_USE_FAULT_INJECTION
+#define MX25R3235F_USE_FAULT_INJECTION                  0U   /* Program/erase/register writes cut on MX25R3235F_FaultCallback request */
+#endif
+
+#ifndef MX25R3235F_TIME_RESOLUTION
+#define MX25R3235F_TIME_RESOLUTION                      1000U /* Resolution of MX25R3235F_TimingGetTime (us) */
+#endif
+
 /** @addtogroup BSP
   * @{
   */ 
@@ -53,6 +81,29 @@
 #define MX25R3235F_FLASH_SIZE                           (uint32_t)(32*1024*1024/8)   /* 32 Mbits => 4MBytes         */
 #define MX25R3235F_PAGE_SIZE                            (uint32_t)256                /* 32768 pages of 256 Bytes    */
 
+#if (MX25R3235F_DUAL_FLASH == 1U)
+#define MX25R3235F_DEVICE_NUMBER                        2U           /* Devices sharing the XSPI interface   */
+#define MX25R3235F_DEVICE_MASK(m)                       ((uint32_t)(m) | ((uint32_t)(m) << 8)) /* Flag of each device status byte */
+#else
+#define MX25R3235F_DEVICE_NUMBER                        1U           /* Devices sharing the XSPI interface   */
+#define MX25R3235F_DEVICE_MASK(m)                       ((uint32_t)(m))
+#endif
+#define MX25R3235F_PROG_PAGE_SIZE                       (MX25R3235F_PAGE_SIZE * MX25R3235F_DEVICE_NUMBER) /* Page of the device set */
+
+#define MX25R3235F_OTP_SIZE                             (uint32_t)(8*1024/8)         /* 8 Kbits => 1KBytes          */
+#define MX25R3235F_OTP_FACTORY_SIZE                     (uint32_t)(4*1024/8)         /* 4 Kbits factory area        */
+
+#define MX25R3235F_INTERFACE_NUMBER                     5U           /* Number of MX25R3235F_Interface_t values */
+
+/**
+  * @brief  MX25R3235F Read calibration configuration
+  */
+#define MX25R3235F_CAL_PATTERN_SIZE                     MX25R3235F_PAGE_SIZE /* Calibration pattern size       */
+#define MX25R3235F_CAL_REPEAT                           4U           /* Pattern reads per configuration      */
+#define MX25R3235F_CAL_GUARD_STEPS                      1U           /* Prescaler steps kept from a failure  */
+#define MX25R3235F_HIGH_PERF_MAX_FREQ                   80000000U    /* fMAX, high performance mode (Hz)     */
+#define MX25R3235F_LOW_POWER_MAX_FREQ                   33000000U    /* fMAX, ultra low power mode (Hz)      */
+
 /**
   * @brief  MX25R3235F Timing configuration
   */
@@ -62,8 +113,13 @@
 #define MX25R3235F_BLOCK_32K_ERASE_MAX_TIME             1050U
 #define MX25R3235F_SECTOR_4K_ERASE_MAX_TIME             240U
 #define MX25R3235F_WRITE_REG_MAX_TIME                   40U
+#define MX25R3235F_PAGE_PROG_MAX_TIME                   10U
+
+#define MX25R3235F_TIMING_SHIFT                         4U                   /* Fixed point fraction bits of the timing statistics */
 
 #define MX25R3235F_RESET_MAX_TIME                       100U                 /* when SWreset during chip erase operation */
+#define MX25R3235F_RELEASE_POWER_DOWN_MAX_TIME          35U                  /* tRES1 (us) */
+#define MX25R3235F_RESUME_TO_SUSPEND_TIME               400U                 /* Erase resume to next suspend (us) */
 
 #define MX25R3235F_AUTOPOLLING_INTERVAL_TIME            0x10U
 
@@ -120,6 +176,7 @@
 
 /* Power Down Operations */
 #define MX25R3235F_DEEP_POWER_DOWN_CMD                  0xB9U  /*!< Deep Power Down                             */
+#define MX25R3235F_RELEASE_DEEP_POWER_DOWN_CMD          0xABU  /*!< Release from Deep Power Down                */
 
 /* Burst Operations */
 #define MX25R3235F_SET_BURST_LENGTH_CMD                 0xC0U  /*!< Set Burst Length                            */
@@ -136,6 +193,11 @@
 #define MX25R3235F_RESET_MEMORY_CMD                     0x99U  /*!< Reset Memory                                */
 #define MX25R3235F_RELEASE_READ_ENHANCED_CMD            0xFFU  /*!< Release Read Enhanced                       */
 
+/**
+  * @brief  MX25R3235F Identification
+  */
+#define MX25R3235F_MANUFACTURER_ID                      0xC2U  /*!< Macronix manufacturer ID                    */
+
 /******************************************************************************
   * @brief  MX25R3235F Registers
   ****************************************************************************/
@@ -187,6 +249,8 @@ typedef enum {
   MX25R3235F_QUAD_IO_MODE                                      /*!< 1-4-4 commands                              */
 } MX25R3235F_Interface_t;
 
+typedef void (*MX25R3235F_StreamCallback_t)(void *pArg, const uint8_t *pData, uint32_t Size);
+
 typedef enum {
   MX25R3235F_ERASE_4K = 0,                                    /*!< 4K size Sector erase                          */
   MX25R3235F_ERASE_32K,                                       /*!< 32K size Block erase                          */
@@ -194,6 +258,113 @@ typedef enum {
   MX25R3235F_ERASE_CHIP                                       /*!< Whole chip erase                              */
 } MX25R3235F_Erase_t;
 
+typedef enum {
+  MX25R3235F_VERIFY_NONE = 0,                                 /*!< No verification after program                 */
+  MX25R3235F_VERIFY_FAIL_FLAG,                                /*!< Read back only when P_FAIL flag is set        */
+  MX25R3235F_VERIFY_READBACK,                                 /*!< Always read back and compare                  */
+  MX25R3235F_VERIFY_FAIL_FLAG_SKIP_ERASED                     /*!< As FAIL_FLAG, pages of 0xFF bytes not written */
+} MX25R3235F_Verify_t;
+
+typedef enum {
+  MX25R3235F_POWER_ACTIVE = 0,                                /*!< Memory in standby, ready for access           */
+  MX25R3235F_POWER_DOWN                                       /*!< Memory in deep power-down                     */
+} MX25R3235F_PowerState_t;
+
+typedef struct {
+  uint32_t                IdleTime;                            /*!< Idle time before deep power-down (ms), 0=off */
+  MX25R3235F_PowerState_t State;                               /*!< Current power state                          */
+  uint32_t                LastAccessTick;                      /*!< Tick of the last access                      */
+  uint32_t                PowerDownTick;                       /*!< Tick of the last deep power-down entry       */
+  uint32_t                PowerDownCount;                      /*!< Number of deep power-down entries            */
+  uint32_t                PowerDownTime;                       /*!< Total time spent in deep power-down (ms)     */
+  uint32_t                WakeUpCount;                         /*!< Number of wake-ups                           */
+  uint32_t                WakeUpLatency;                       /*!< Total wake-up latency (us)                   */
+  uint32_t                WakeUpLatencyMax;                    /*!< Maximum wake-up latency (us)                 */
+} MX25R3235F_Power_t;
+
+typedef struct {
+  uint8_t  Data[MX25R3235F_OTP_SIZE];                          /*!< Copy of the secured OTP area                 */
+  uint8_t  SecurityReg;                                        /*!< Security register (SOI, LDSO)                */
+  uint8_t  Loaded;                                             /*!< Cache content valid                          */
+} MX25R3235F_OTP_t;
+
+typedef struct {
+  uint8_t  Reg[3];                                             /*!< Status, configuration 1 and 2 registers      */
+  uint8_t  LockedBP;                                           /*!< BP bits restored at the end of an unlock     */
+  uint8_t  Loaded;                                             /*!< Cache content valid                          */
+} MX25R3235F_Protect_t;
+
+typedef enum {
+  MX25R3235F_OPERATION_PROGRAM = 0,                           /*!< Page program                                  */
+  MX25R3235F_OPERATION_ERASE_4K,                              /*!< 4K size Sector erase                          */
+  MX25R3235F_OPERATION_ERASE_32K,                             /*!< 32K size Block erase                          */
+  MX25R3235F_OPERATION_ERASE_64K,                             /*!< 64K size Block erase                          */
+  MX25R3235F_OPERATION_ERASE_CHIP,                            /*!< Whole chip erase                              */
+  MX25R3235F_OPERATION_NUMBER                                 /*!< Number of operation types                     */
+} MX25R3235F_Operation_t;
+
+typedef enum {
+  MX25R3235F_PERCENTILE_50 = 0,                               /*!< Median duration                               */
+  MX25R3235F_PERCENTILE_90,                                   /*!< 90th percentile duration                      */
+  MX25R3235F_PERCENTILE_99,                                   /*!< 99th percentile duration                      */
+  MX25R3235F_PERCENTILE_NUMBER                                /*!< Number of tracked percentiles                 */
+} MX25R3235F_Percentile_t;
+
+typedef struct {
+  uint32_t Count;                                              /*!< Number of measured operations                */
+  uint32_t Min;                                                /*!< Minimum duration (us)                        */
+  uint32_t Max;                                                /*!< Maximum duration (us)                        */
+  uint32_t Mean;                                               /*!< Running mean (us, MX25R3235F_TIMING_SHIFT)   */
+  uint32_t Estimate[MX25R3235F_PERCENTILE_NUMBER];             /*!< Percentiles (us, MX25R3235F_TIMING_SHIFT)    */
+} MX25R3235F_OperationTiming_t;
+
+typedef struct {
+  MX25R3235F_OperationTiming_t Operation[MX25R3235F_OPERATION_NUMBER]; /*!< Statistics per operation type        */
+  MX25R3235F_Operation_t       Current;                        /*!< Operation in progress                        */
+  uint32_t                     StartTime;                      /*!< Time of the start of the operation (us)      */
+} MX25R3235F_Timing_t;
+
+typedef enum {
+  MX25R3235F_TRACE_READ = 0,                                  /*!< Read command                                  */
+  MX25R3235F_TRACE_PROGRAM,                                   /*!< Page program command                          */
+  MX25R3235F_TRACE_ERASE                                      /*!< Sector, block or chip erase command           */
+} MX25R3235F_TraceOperation_t;
+
+typedef struct {
+  uint32_t Timestamp;                                          /*!< Time the command was sent (us)               */
+  uint32_t Address;                                            /*!< Start address                                */
+  uint32_t Size;                                               /*!< Size in bytes                                */
+  uint32_t Operation;                                          /*!< MX25R3235F_TraceOperation_t value            */
+  uint32_t Mode;                                               /*!< MX25R3235F_Interface_t value actually used   */
+} MX25R3235F_TraceRecord_t;
+
+typedef enum {
+  MX25R3235F_FAULT_PROGRAM = 0,                               /*!< Page program                                  */
+  MX25R3235F_FAULT_ERASE,                                     /*!< Sector, block or chip erase                   */
+  MX25R3235F_FAULT_WRITE_REG                                  /*!< Status and configuration registers write      */
+} MX25R3235F_FaultOperation_t;
+
+typedef struct {
+  const uint8_t          *pBase;                               /*!< XSPI memory mapped window                    */
+  MX25R3235F_Interface_t Mode;                                 /*!< Interface mode                               */
+  uint32_t               Mapped;                               /*!< Memory mapped mode enabled                   */
+  uint32_t               Generation;                           /*!< Incremented by each MX25R3235F_MapDisable()  */
+} MX25R3235F_Map_t;
+
+typedef struct {
+  uint32_t Prescaler[MX25R3235F_INTERFACE_NUMBER];             /*!< Calibrated XSPI clock prescaler per mode      */
+  uint32_t SampleShifting[MX25R3235F_INTERFACE_NUMBER];        /*!< Sample shifting used with it                 */
+  uint32_t Valid;                                              /*!< Bit n set when mode n passed                 */
+} MX25R3235F_Calibration_t;
+
+typedef struct {
+  XSPI_HandleTypeDef     *Ctx;                                 /*!< XSPI handle of the instance                  */
+  MX25R3235F_Interface_t Mode;                                 /*!< Interface mode of the instance               */
+  MX25R3235F_Power_t     Power;                                /*!< Deep power-down manager of the instance      */
+  MX25R3235F_Map_t       Map;                                  /*!< Memory mapped window of the instance         */
+  uint32_t               ReadSize;                             /*!< Size of the read in flight, 0 if none        */
+  uint32_t               IsInitialized;                        /*!< Set by MX25R3235F_ObjectInit()               */
+} MX25R3235F_Object_t;
 /**
   * @}
   */ 
@@ -203,16 +374,31 @@ typedef enum {
   */ 
 /* Function by commands combined */
 int32_t MX25R3235F_GetFlashInfo(MX25R3235F_Info_t *pInfo);
+int32_t MX25R3235F_AutoPollingMemReady(XSPI_HandleTypeDef *Ctx, uint32_t Timeout);
+int32_t MX25R3235F_Write(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint8_t *pData, uint32_t WriteAddr,
+                         uint32_t Size, MX25R3235F_Verify_t Verify, uint32_t *pFailAddr);
 
 /* Read/Write Array Commands **************************************************/
 int32_t MX25R3235F_Read(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
-int32_t MX25R3235F_PageProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
+int32_t MX25R3235F_ReadStream(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t ReadAddr, uint32_t Size,
+                              uint8_t *pBuffer, uint32_t BufferSize, MX25R3235F_StreamCallback_t Callback, void *pArg);
+int32_t MX25R3235F_PageProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
 int32_t MX25R3235F_BlockErase(XSPI_HandleTypeDef *Ctx, uint32_t BlockAddress, MX25R3235F_Erase_t BlockSize);
 int32_t MX25R3235F_ChipErase(XSPI_HandleTypeDef *Ctx);
 int32_t MX25R3235F_EnableMemoryMappedMode(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode);
+int32_t MX25R3235F_DisableMemoryMappedMode(XSPI_HandleTypeDef *Ctx);
 int32_t MX25R3235F_Suspend(XSPI_HandleTypeDef *Ctx);
 int32_t MX25R3235F_Resume(XSPI_HandleTypeDef *Ctx);
 
+/* Verification Commands ******************************************************/
+uint32_t MX25R3235F_CRC32(uint32_t Crc, const uint8_t *pData, uint32_t Size);
+int32_t MX25R3235F_ReadCRC32(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t ReadAddr, uint32_t Size,
+                             uint8_t *pBuffer, uint32_t BufferSize, uint32_t *pCrc);
+
+/* Storage Helper Commands ****************************************************/
+uint32_t MX25R3235F_Get32(const uint8_t *pData);
+void    MX25R3235F_Put32(uint8_t *pData, uint32_t Value);
+
 /* Register/Setting Commands **************************************************/
 int32_t MX25R3235F_WriteEnable(XSPI_HandleTypeDef *Ctx);
 int32_t MX25R3235F_WriteDisable(XSPI_HandleTypeDef *Ctx);
@@ -225,14 +411,75 @@ int32_t MX25R3235F_ReadCfg2Register(XSPI_HandleTypeDef *Ctx, uint8_t *Value);
 int32_t MX25R3235F_WriteSecurityRegister(XSPI_HandleTypeDef *Ctx, uint8_t Value);
 int32_t MX25R3235F_ReadSecurityRegister(XSPI_HandleTypeDef *Ctx, uint8_t *Value);
 
+/* Block Protection Commands **************************************************/
+int32_t MX25R3235F_ProtectLoad(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect);
+int32_t MX25R3235F_GetProtectedArea(const MX25R3235F_Protect_t *pProtect, uint32_t *pStart, uint32_t *pSize);
+int32_t MX25R3235F_ProtectRange(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect, uint32_t Address,
+                                uint32_t Size, uint32_t AllowBottom);
+int32_t MX25R3235F_UnlockBegin(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect, uint32_t Address, uint32_t Size);
+int32_t MX25R3235F_UnlockEnd(XSPI_HandleTypeDef *Ctx, MX25R3235F_Protect_t *pProtect);
+
 /* ID/Security Commands *******************************************************/
 int32_t MX25R3235F_ReadID(XSPI_HandleTypeDef *Ctx, uint8_t *ID);
+int32_t MX25R3235F_EnterSecuredOTP(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_ExitSecuredOTP(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_OTPRead(XSPI_HandleTypeDef *Ctx, MX25R3235F_OTP_t *pOTP, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
+int32_t MX25R3235F_OTPProgram(XSPI_HandleTypeDef *Ctx, MX25R3235F_OTP_t *pOTP, uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
+int32_t MX25R3235F_OTPLock(XSPI_HandleTypeDef *Ctx, MX25R3235F_OTP_t *pOTP);
 
 /* Reset Commands *************************************************************/
 int32_t MX25R3235F_ResetEnable(XSPI_HandleTypeDef *Ctx);
 int32_t MX25R3235F_ResetMemory(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_ReleaseReadEnhanced(XSPI_HandleTypeDef *Ctx);
 int32_t MX25R3235F_NoOperation(XSPI_HandleTypeDef *Ctx);
 int32_t MX25R3235F_EnterPowerDown(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_LeavePowerDown(XSPI_HandleTypeDef *Ctx);
+int32_t MX25R3235F_Recover(XSPI_HandleTypeDef *Ctx);
+
+/* Power Management Commands **************************************************/
+int32_t MX25R3235F_PowerInit(MX25R3235F_Power_t *pPower, uint32_t IdleTime);
+int32_t MX25R3235F_PowerWakeUp(XSPI_HandleTypeDef *Ctx, MX25R3235F_Power_t *pPower);
+int32_t MX25R3235F_PowerProcess(XSPI_HandleTypeDef *Ctx, MX25R3235F_Power_t *pPower);
+
+/* Operation Timing Commands **************************************************/
+int32_t MX25R3235F_TimingInit(MX25R3235F_Timing_t *pTiming);
+int32_t MX25R3235F_TimingStart(MX25R3235F_Timing_t *pTiming, MX25R3235F_Operation_t Operation);
+int32_t MX25R3235F_TimingStop(MX25R3235F_Timing_t *pTiming);
+uint32_t MX25R3235F_TimingPredict(const MX25R3235F_Timing_t *pTiming, MX25R3235F_Operation_t Operation,
+                                  MX25R3235F_Percentile_t Percentile);
+uint32_t MX25R3235F_TimingRemaining(const MX25R3235F_Timing_t *pTiming, MX25R3235F_Percentile_t Percentile);
+int32_t MX25R3235F_TimingWait(XSPI_HandleTypeDef *Ctx, MX25R3235F_Timing_t *pTiming);
+uint32_t MX25R3235F_TimingGetTime(void);
+
+/* Trace Commands *************************************************************/
+void MX25R3235F_TraceCallback(XSPI_HandleTypeDef *Ctx, const MX25R3235F_TraceRecord_t *pRecord);
+
+/* Fault Injection Commands ***************************************************/
+uint32_t MX25R3235F_FaultCallback(XSPI_HandleTypeDef *Ctx, MX25R3235F_FaultOperation_t Operation, uint32_t Address);
+
+/* Zero-Copy Read Commands ****************************************************/
+int32_t MX25R3235F_MapInit(MX25R3235F_Map_t *pMap, const uint8_t *pBase, MX25R3235F_Interface_t Mode);
+int32_t MX25R3235F_MapEnable(XSPI_HandleTypeDef *Ctx, MX25R3235F_Map_t *pMap);
+int32_t MX25R3235F_MapDisable(XSPI_HandleTypeDef *Ctx, MX25R3235F_Map_t *pMap);
+int32_t MX25R3235F_Borrow(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Map_t *pMap, uint32_t ReadAddr, uint32_t Size,
+                          uint8_t *pBuffer, const uint8_t **ppData, uint32_t *pGeneration);
+uint32_t MX25R3235F_BorrowValid(const MX25R3235F_Map_t *pMap, uint32_t Generation);
+
+/* Read Calibration Commands **************************************************/
+int32_t MX25R3235F_Calibrate(XSPI_HandleTypeDef *Ctx, MX25R3235F_Calibration_t *pCalibration, uint32_t PatternAddress,
+                             uint32_t ClockFrequency);
+int32_t MX25R3235F_CalibrationApply(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Calibration_t *pCalibration,
+                                    MX25R3235F_Interface_t Mode);
+
+/* Copy Commands **************************************************************/
+int32_t MX25R3235F_Copy(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t SrcAddr, uint32_t DstAddr,
+                        uint32_t Size, uint8_t *pBuffer, uint32_t BufferSize);
+
+/* Instance Commands **********************************************************/
+int32_t MX25R3235F_ObjectInit(MX25R3235F_Object_t *pObj, XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode,
+                              const uint8_t *pMapBase, uint32_t IdleTime);
+int32_t MX25R3235F_ReadStart(MX25R3235F_Object_t *pObj, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
+int32_t MX25R3235F_ReadComplete(MX25R3235F_Object_t *pObj, uint32_t *pDone);
 
 /**
   * @}
@@ -0,0 +1,250 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_bd.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the block device adapter on top of the MX25R3235F
+ *          XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_bd.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_BD MX25R3235F Block Device
+  * @{
+  */
+
+/** @defgroup MX25R3235F_BD_Exported_Functions MX25R3235F BD Exported Functions
+  * @{
+  */
+
+/* Block Device Commands ******************************************************/
+/**
+  * @brief  Initialize a block device on a memory area, for filesystem glue code
+  * @param  pDevice Block device pointer
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @param  BaseAddress Start of the area, aligned on the erase sector size
+  * @param  Size Size of the area, multiple of the erase sector size
+  * @param  pCache Read-ahead buffer, or NULL to read the memory directly
+  * @param  CacheSize Size of the read-ahead buffer, multiple of the page size
+  * @note   The geometry comes from MX25R3235F_GetFlashInfo(): block size is the
+  *         erase sector size, program size the page size. The read-ahead
+  *         buffer is filled by aligned chunks of CacheSize bytes.
+  * @retval error status
+  */
+int32_t MX25R3235F_BDInit(MX25R3235F_BlockDevice_t *pDevice, XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode,
+                          uint32_t BaseAddress, uint32_t Size, uint8_t *pCache, uint32_t CacheSize)
+{
+  MX25R3235F_Info_t info;
+
+  (void)MX25R3235F_GetFlashInfo(&info);
+
+  if (((BaseAddress % info.EraseSectorSize) != 0U) || ((Size % info.EraseSectorSize) != 0U) || (Size == 0U) ||
+      (BaseAddress >= info.FlashSize) || (Size > (info.FlashSize - BaseAddress)) ||
+      ((pCache != NULL) && ((CacheSize == 0U) || ((CacheSize % info.ProgPageSize) != 0U) ||
+                            ((info.EraseSectorSize % CacheSize) != 0U))))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pDevice->Ctx          = Ctx;
+  pDevice->Mode         = Mode;
+  pDevice->BaseAddress  = BaseAddress;
+  pDevice->ReadSize     = 1U;
+  pDevice->ProgSize     = info.ProgPageSize;
+  pDevice->BlockSize    = info.EraseSectorSize;
+  pDevice->BlockCount   = Size / info.EraseSectorSize;
+  pDevice->pCache       = pCache;
+  pDevice->CacheSize    = (pCache != NULL) ? CacheSize : 0U;
+  pDevice->CacheAddress = MX25R3235F_BD_NO_CACHE;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Read data from a block
+  * @param  pDevice Block device pointer
+  * @param  Block Block index
+  * @param  Offset Offset in the block
+  * @param  pBuffer Pointer to data to be read
+  * @param  Size Size of data to read
+  * @note   With MX25R3235F_DUAL_FLASH set, the address and the size must be
+  *         even, as for MX25R3235F_Read().
+  * @retval error status
+  */
+int32_t MX25R3235F_BDRead(MX25R3235F_BlockDevice_t *pDevice, uint32_t Block, uint32_t Offset, uint8_t *pBuffer,
+                          uint32_t Size)
+{
+  uint32_t address;
+  uint32_t chunk;
+  uint32_t length;
+
+  address = pDevice->BaseAddress + (Block * pDevice->BlockSize) + Offset;
+
+  if ((Block >= pDevice->BlockCount) || (Offset > pDevice->BlockSize) || (Size > (pDevice->BlockSize - Offset)) ||
+      (((address | Size) % MX25R3235F_DEVICE_NUMBER) != 0U))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Large reads bypass the read-ahead buffer */
+  if ((pDevice->pCache == NULL) || (Size >= pDevice->CacheSize))
+  {
+    return MX25R3235F_Read(pDevice->Ctx, pDevice->Mode, pBuffer, address, Size);
+  }
+
+  while (Size > 0U)
+  {
+    chunk = address - (address % pDevice->CacheSize);
+    if (chunk != pDevice->CacheAddress)
+    {
+      pDevice->CacheAddress = MX25R3235F_BD_NO_CACHE;
+      if (MX25R3235F_Read(pDevice->Ctx, pDevice->Mode, pDevice->pCache, chunk, pDevice->CacheSize) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+      pDevice->CacheAddress = chunk;
+    }
+
+    length = pDevice->CacheSize - (address - chunk);
+    if (length > Size)
+    {
+      length = Size;
+    }
+
+    (void)memcpy(pBuffer, &pDevice->pCache[address - chunk], length);
+
+    pBuffer += length;
+    address += length;
+    Size    -= length;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Program data in a block
+  * @param  pDevice Block device pointer
+  * @param  Block Block index
+  * @param  Offset Offset in the block
+  * @param  pBuffer Pointer to data to be written
+  * @param  Size Size of data to write
+  * @note   The program is complete, and checked with the P_FAIL flag, on return.
+  * @retval error status
+  */
+int32_t MX25R3235F_BDProg(MX25R3235F_BlockDevice_t *pDevice, uint32_t Block, uint32_t Offset, const uint8_t *pBuffer,
+                          uint32_t Size)
+{
+  uint32_t address;
+
+  if ((Block >= pDevice->BlockCount) || (Offset > pDevice->BlockSize) || (Size > (pDevice->BlockSize - Offset)))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  address = pDevice->BaseAddress + (Block * pDevice->BlockSize) + Offset;
+
+  /* The cached chunk may overlap the programmed area */
+  if ((pDevice->CacheAddress != MX25R3235F_BD_NO_CACHE) && (address < (pDevice->CacheAddress + pDevice->CacheSize)) &&
+      ((address + Size) > pDevice->CacheAddress))
+  {
+    pDevice->CacheAddress = MX25R3235F_BD_NO_CACHE;
+  }
+
+  return MX25R3235F_Write(pDevice->Ctx, pDevice->Mode, pBuffer, address, Size,
+                          MX25R3235F_VERIFY_FAIL_FLAG, NULL);
+}
+
+/**
+  * @brief  Erase a block
+  * @param  pDevice Block device pointer
+  * @param  Block Block index
+  * @note   The erase is complete, and checked with the E_FAIL flag, on return.
+  * @retval error status
+  */
+int32_t MX25R3235F_BDErase(MX25R3235F_BlockDevice_t *pDevice, uint32_t Block)
+{
+  uint32_t address;
+  uint8_t  secr;
+
+  if (Block >= pDevice->BlockCount)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  address = pDevice->BaseAddress + (Block * pDevice->BlockSize);
+
+  if ((pDevice->CacheAddress != MX25R3235F_BD_NO_CACHE) && (pDevice->CacheAddress >= address) &&
+      (pDevice->CacheAddress < (address + pDevice->BlockSize)))
+  {
+    pDevice->CacheAddress = MX25R3235F_BD_NO_CACHE;
+  }
+
+  if ((MX25R3235F_WriteEnable(pDevice->Ctx) != MX25R3235F_OK) ||
+      (MX25R3235F_BlockErase(pDevice->Ctx, address, MX25R3235F_ERASE_4K) != MX25R3235F_OK) ||
+      (MX25R3235F_AutoPollingMemReady(pDevice->Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK) ||
+      (MX25R3235F_ReadSecurityRegister(pDevice->Ctx, &secr) != MX25R3235F_OK))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return ((secr & MX25R3235F_SECR_E_FAIL) != 0U) ? MX25R3235F_ERROR : MX25R3235F_OK;
+}
+
+/**
+  * @brief  Wait for the end of any pending operation
+  * @param  pDevice Block device pointer
+  * @note   Program and erase already complete before returning: this only
+  *         makes sure the memory is ready.
+  * @retval error status
+  */
+int32_t MX25R3235F_BDSync(MX25R3235F_BlockDevice_t *pDevice)
+{
+  return MX25R3235F_AutoPollingMemReady(pDevice->Ctx, HAL_XSPI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
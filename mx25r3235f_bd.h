@@ -0,0 +1,119 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_bd.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the block device adapter of
+  *          the MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_BD_H
+#define MX25R3235F_BD_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_BD
+  * @{
+  */
+
+/** @defgroup MX25R3235F_BD_Exported_Constants MX25R3235F BD Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Block device configuration
+  */
+#define MX25R3235F_BD_NO_CACHE                          0xFFFFFFFFU  /* Read-ahead buffer empty              */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_BD_Exported_Types MX25R3235F BD Exported Types
+  * @{
+  */
+typedef struct {
+  XSPI_HandleTypeDef     *Ctx;                                 /*!< Component object pointer                     */
+  MX25R3235F_Interface_t Mode;                                 /*!< Interface mode                               */
+  uint32_t               BaseAddress;                          /*!< Start of the area                            */
+  uint32_t               ReadSize;                             /*!< Minimum read size hint                       */
+  uint32_t               ProgSize;                             /*!< Program size hint: page size                 */
+  uint32_t               BlockSize;                            /*!< Block size: erase sector size                */
+  uint32_t               BlockCount;                           /*!< Number of blocks                             */
+  uint8_t                *pCache;                              /*!< Read-ahead buffer, NULL if none              */
+  uint32_t               CacheSize;                            /*!< Read-ahead size                              */
+  uint32_t               CacheAddress;                         /*!< Address of the buffered chunk                */
+} MX25R3235F_BlockDevice_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_BD_Exported_Functions MX25R3235F BD Exported Functions
+  * @{
+  */
+/* Block Device Commands ******************************************************/
+int32_t MX25R3235F_BDInit(MX25R3235F_BlockDevice_t *pDevice, XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode,
+                          uint32_t BaseAddress, uint32_t Size, uint8_t *pCache, uint32_t CacheSize);
+int32_t MX25R3235F_BDRead(MX25R3235F_BlockDevice_t *pDevice, uint32_t Block, uint32_t Offset, uint8_t *pBuffer,
+                          uint32_t Size);
+int32_t MX25R3235F_BDProg(MX25R3235F_BlockDevice_t *pDevice, uint32_t Block, uint32_t Offset, const uint8_t *pBuffer,
+                          uint32_t Size);
+int32_t MX25R3235F_BDErase(MX25R3235F_BlockDevice_t *pDevice, uint32_t Block);
+int32_t MX25R3235F_BDSync(MX25R3235F_BlockDevice_t *pDevice);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_BD_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -31,6 +31,40 @@
 #define DUMMY_CYCLES_READ_DUAL       4U
 #define DUMMY_CYCLES_READ_QUAD       6U
 
+/* Set to 1U to overlap chunked reads (CRC, streaming) with data processing.
+   The XSPI handle must be linked to a DMA channel with its IRQ enabled. */
+#define MX25R3235F_USE_DMA           0U
+
+/* Set to 1U when two devices share the XSPI interface: the XSPI handle must
+   be initialized with MemoryMode = HAL_XSPI_DUAL_MEM. Data is interleaved
+   byte-wise by the controller and the geometry reported by
+   MX25R3235F_GetFlashInfo() is doubled. The storage modules laid out on the
+   4K sector of a single device (mx25r3235f_kv, _update, _remap, _pool and
+   _index) are not supported: their mount and init functions return
+   MX25R3235F_ERROR. */
+#define MX25R3235F_DUAL_FLASH        0U
+
+/* Set to 1U to report each read, program and erase command to
+   MX25R3235F_TraceCallback, for workload capture. */
+#define MX25R3235F_USE_TRACE         0U
+
+/* Set to 1U on test builds only to cut programs, erases and status register
+   writes when MX25R3235F_FaultCallback requests it, emulating a power loss
+   for recovery tests. */
+#define MX25R3235F_USE_FAULT_INJECTION 0U
+
+/* Resolution in us of MX25R3235F_TimingGetTime: 1000U for the default HAL
+   tick implementation, 1U once overridden with a us timer. The short polling
+   timeouts (wake-up from deep power-down) are extended by it. */
+#define MX25R3235F_TIME_RESOLUTION   1000U
+
+/* Uncomment to build the driver for a single interface mode
+   (MX25R3235F_FIXED_SPI, _DUAL_OUT, _DUAL_IO, _QUAD_OUT or _QUAD_IO): the
+   Mode parameter of the read, program and memory mapped functions is then
+   ignored and the per-mode selection is removed from the code. The trace
+   records hold the mode actually used, and only that read mode is calibrated. */
+/* #define MX25R3235F_FIXED_MODE        MX25R3235F_FIXED_QUAD_IO */
+
 #ifdef __cplusplus
 }
 #endif
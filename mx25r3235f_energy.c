@@ -0,0 +1,352 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_energy.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the energy and bandwidth cost model on top of the
+ *          MX25R3235F XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_energy.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Energy MX25R3235F Energy Model
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Energy_Private_Variables MX25R3235F Energy Private Variables
+  * @{
+  */
+/* Address lines, data lines and dummy cycles of the read command of each
+   MX25R3235F_Interface_t, for the energy model */
+static const uint8_t MX25R3235F_ReadFormat[MX25R3235F_INTERFACE_NUMBER][3] =
+{
+  {1U, 1U, DUMMY_CYCLES_READ}, {1U, 2U, DUMMY_CYCLES_READ}, {2U, 2U, DUMMY_CYCLES_READ_DUAL},
+  {1U, 4U, DUMMY_CYCLES_READ}, {4U, 4U, DUMMY_CYCLES_READ_QUAD}
+};
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Energy_Exported_Functions MX25R3235F Energy Exported Functions
+  * @{
+  */
+
+/* Energy Model Commands ******************************************************/
+/**
+  * @brief  Initialize an energy accounting context with the default model
+  * @param  pEnergy Energy accounting context pointer
+  * @param  ClockFrequency XSPI clock frequency in kHz
+  * @param  Voltage Supply voltage in mV
+  * @note   The default currents and timings of the model are indicative
+  *         typical values: pEnergy->Model is to be adjusted from the datasheet
+  *         for the power mode and clock in use. The counters are cleared.
+  * @retval None
+  */
+void MX25R3235F_EnergyInit(MX25R3235F_Energy_t *pEnergy, uint32_t ClockFrequency, uint32_t Voltage)
+{
+  (void)memset(pEnergy, 0, sizeof(MX25R3235F_Energy_t));
+
+  pEnergy->Model.ClockFrequency                        = ClockFrequency;
+  pEnergy->Model.Voltage                               = Voltage;
+  pEnergy->Model.ReadCurrent[MX25R3235F_SPI_MODE]      = MX25R3235F_ENERGY_READ_CURRENT_1;
+  pEnergy->Model.ReadCurrent[MX25R3235F_DUAL_OUT_MODE] = MX25R3235F_ENERGY_READ_CURRENT_2;
+  pEnergy->Model.ReadCurrent[MX25R3235F_DUAL_IO_MODE]  = MX25R3235F_ENERGY_READ_CURRENT_2;
+  pEnergy->Model.ReadCurrent[MX25R3235F_QUAD_OUT_MODE] = MX25R3235F_ENERGY_READ_CURRENT_4;
+  pEnergy->Model.ReadCurrent[MX25R3235F_QUAD_IO_MODE]  = MX25R3235F_ENERGY_READ_CURRENT_4;
+  pEnergy->Model.ProgramCurrent                        = MX25R3235F_ENERGY_PROGRAM_CURRENT;
+  pEnergy->Model.EraseCurrent                          = MX25R3235F_ENERGY_ERASE_CURRENT;
+  pEnergy->Model.ProgramTime                           = MX25R3235F_ENERGY_PROGRAM_TIME;
+  pEnergy->Model.EraseTime[MX25R3235F_ERASE_4K]        = MX25R3235F_ENERGY_ERASE_4K_TIME;
+  pEnergy->Model.EraseTime[MX25R3235F_ERASE_32K]       = MX25R3235F_ENERGY_ERASE_32K_TIME;
+  pEnergy->Model.EraseTime[MX25R3235F_ERASE_64K]       = MX25R3235F_ENERGY_ERASE_64K_TIME;
+  pEnergy->Model.EraseTime[MX25R3235F_ERASE_CHIP]      = MX25R3235F_ENERGY_ERASE_CHIP_TIME;
+}
+
+/**
+  * @brief  Estimate the duration and energy of a command
+  * @param  pModel Cost model pointer
+  * @param  Operation Operation type
+  * @param  Mode Interface mode (SPI or QUAD_INOUT for a program, unused for an erase)
+  * @param  Size Bytes read or programmed, or size of the erased block
+  * @param  pTime Returns the duration in us
+  * @param  pEnergy Returns the energy in nJ
+  * @note   A read costs its bus cycles (instruction, address, dummy, data) at
+  *         the read current of the mode. A program costs, per page, the bus
+  *         cycles of Write Enable and Page Program at the read current of the
+  *         mode, then the page program time at the program current. An erase
+  *         costs the erase time at the erase current. Status polling is not
+  *         counted.
+  * @retval error status
+  */
+int32_t MX25R3235F_EnergyCost(const MX25R3235F_EnergyModel_t *pModel, MX25R3235F_TraceOperation_t Operation,
+                              MX25R3235F_Interface_t Mode, uint32_t Size, uint32_t *pTime, uint32_t *pEnergy)
+{
+  uint32_t cycles;
+  uint32_t pages;
+  uint32_t lines;
+  uint32_t time;
+  uint64_t energy;
+
+  if ((pModel->ClockFrequency == 0U) || ((uint32_t)Mode >= MX25R3235F_INTERFACE_NUMBER))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  switch (Operation)
+  {
+  case MX25R3235F_TRACE_READ :
+    cycles = 8U + (24U / MX25R3235F_ReadFormat[Mode][0]) + MX25R3235F_ReadFormat[Mode][2] +
+             ((8U * Size) / MX25R3235F_ReadFormat[Mode][1]);
+    time   = (uint32_t)(((uint64_t)cycles * 1000U) / pModel->ClockFrequency);
+    energy = (uint64_t)time * pModel->ReadCurrent[Mode];
+    break;
+
+  case MX25R3235F_TRACE_PROGRAM :
+    if ((Mode != MX25R3235F_SPI_MODE) && (Mode != MX25R3235F_QUAD_IO_MODE))
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    lines  = (Mode == MX25R3235F_SPI_MODE) ? 1U : 4U;
+    pages  = (Size + MX25R3235F_PAGE_SIZE - 1U) / MX25R3235F_PAGE_SIZE;
+    cycles = (pages * (8U + 8U + (24U / lines))) + ((8U * Size) / lines);
+    time   = (uint32_t)(((uint64_t)cycles * 1000U) / pModel->ClockFrequency);
+    energy = ((uint64_t)time * pModel->ReadCurrent[Mode]) +
+             ((uint64_t)pages * pModel->ProgramTime * pModel->ProgramCurrent);
+    time  += pages * pModel->ProgramTime;
+    break;
+
+  case MX25R3235F_TRACE_ERASE :
+    switch (Size)
+    {
+    case MX25R3235F_SECTOR_4K :
+      time = pModel->EraseTime[MX25R3235F_ERASE_4K];
+      break;
+    case MX25R3235F_BLOCK_32K :
+      time = pModel->EraseTime[MX25R3235F_ERASE_32K];
+      break;
+    case MX25R3235F_BLOCK_64K :
+      time = pModel->EraseTime[MX25R3235F_ERASE_64K];
+      break;
+    case MX25R3235F_FLASH_SIZE :
+      time = pModel->EraseTime[MX25R3235F_ERASE_CHIP];
+      break;
+    default :
+      return MX25R3235F_ERROR;
+    }
+    energy = (uint64_t)time * pModel->EraseCurrent;
+    break;
+
+  default :
+    return MX25R3235F_ERROR;
+  }
+
+  /* us x uA x mV = fJ */
+  *pTime   = time;
+  *pEnergy = (uint32_t)((energy * pModel->Voltage) / 1000000U);
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Add the estimated cost of a traced command to the energy counters
+  * @param  pEnergy Energy accounting context pointer
+  * @param  pRecord Trace record
+  * @note   To be called from MX25R3235F_TraceCallback() (MX25R3235F_USE_TRACE
+  *         set), so that every read, program and erase sent by the driver and
+  *         the features built on it is accounted per operation type.
+  * @retval error status
+  */
+int32_t MX25R3235F_EnergyAccount(MX25R3235F_Energy_t *pEnergy, const MX25R3235F_TraceRecord_t *pRecord)
+{
+  MX25R3235F_EnergyCounter_t *counter;
+  uint32_t time;
+  uint32_t energy;
+
+  if ((pRecord->Operation > (uint32_t)MX25R3235F_TRACE_ERASE) ||
+      (MX25R3235F_EnergyCost(&pEnergy->Model, (MX25R3235F_TraceOperation_t)pRecord->Operation,
+                             (MX25R3235F_Interface_t)pRecord->Mode, pRecord->Size, &time, &energy) != MX25R3235F_OK))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  counter = &pEnergy->Counter[pRecord->Operation];
+  counter->Count++;
+  counter->Bytes          += pRecord->Size;
+  counter->TimeFraction   += time;
+  counter->EnergyFraction += energy;
+  counter->Time           += counter->TimeFraction / 1000U;
+  counter->Energy         += counter->EnergyFraction / 1000U;
+  counter->TimeFraction   %= 1000U;
+  counter->EnergyFraction %= 1000U;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Recommend the cheapest interface modes and erase granularity
+  * @param  pModel Cost model pointer
+  * @param  pProfile Transfer profile over a period
+  * @param  pAdvice Returns the recommendation and the estimated cost per period
+  * @note   The read mode is chosen among the five interface modes and the
+  *         program mode between SPI and QUAD_INOUT. For the erase, each
+  *         EraseSize area is split in the largest blocks up to the candidate
+  *         granularity (4K, 32K or 64K); the granularity with the lowest
+  *         energy is returned, the finer one on a tie as it erases less data
+  *         at once. The chip erase is not considered.
+  * @retval error status
+  */
+int32_t MX25R3235F_EnergyAdvise(const MX25R3235F_EnergyModel_t *pModel, const MX25R3235F_EnergyProfile_t *pProfile,
+                                MX25R3235F_EnergyAdvice_t *pAdvice)
+{
+  static const uint32_t block[3] = {MX25R3235F_SECTOR_4K, MX25R3235F_BLOCK_32K, MX25R3235F_BLOCK_64K};
+  static const MX25R3235F_Interface_t program_mode[2] = {MX25R3235F_SPI_MODE, MX25R3235F_QUAD_IO_MODE};
+  uint64_t best;
+  uint64_t cost;
+  uint64_t total_energy = 0U;
+  uint64_t total_time = 0U;
+  uint32_t best_time = 0U;
+  uint32_t erase_time;
+  uint32_t time;
+  uint32_t energy;
+  uint32_t remaining;
+  uint32_t index;
+  uint32_t unit;
+
+  if ((pProfile->EraseSize % MX25R3235F_SECTOR_4K) != 0U)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Read */
+  best = UINT64_MAX;
+  for (index = 0U; index < MX25R3235F_INTERFACE_NUMBER; index++)
+  {
+    if (MX25R3235F_EnergyCost(pModel, MX25R3235F_TRACE_READ, (MX25R3235F_Interface_t)index, pProfile->ReadSize,
+                              &time, &energy) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    cost = (uint64_t)energy * pProfile->ReadCount;
+    if (cost < best)
+    {
+      best              = cost;
+      best_time         = time;
+      pAdvice->ReadMode = (MX25R3235F_Interface_t)index;
+    }
+  }
+  total_energy += best;
+  total_time   += (uint64_t)best_time * pProfile->ReadCount;
+
+  /* Program */
+  best = UINT64_MAX;
+  for (index = 0U; index < 2U; index++)
+  {
+    if (MX25R3235F_EnergyCost(pModel, MX25R3235F_TRACE_PROGRAM, program_mode[index], pProfile->WriteSize,
+                              &time, &energy) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    cost = (uint64_t)energy * pProfile->WriteCount;
+    if (cost < best)
+    {
+      best                 = cost;
+      best_time            = time;
+      pAdvice->ProgramMode = program_mode[index];
+    }
+  }
+  total_energy += best;
+  total_time   += (uint64_t)best_time * pProfile->WriteCount;
+
+  /* Erase */
+  best = UINT64_MAX;
+  for (index = 0U; index < 3U; index++)
+  {
+    cost       = 0U;
+    erase_time = 0U;
+    remaining  = pProfile->EraseSize;
+    unit       = index;
+    while (remaining != 0U)
+    {
+      /* Largest block up to the candidate granularity */
+      while (block[unit] > remaining)
+      {
+        unit--;
+      }
+
+      if (MX25R3235F_EnergyCost(pModel, MX25R3235F_TRACE_ERASE, MX25R3235F_SPI_MODE, block[unit],
+                                &time, &energy) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      cost       += energy;
+      erase_time += time;
+      remaining  -= block[unit];
+    }
+
+    cost *= pProfile->EraseCount;
+    if (cost < best)
+    {
+      best           = cost;
+      best_time      = erase_time;
+      pAdvice->Erase = (MX25R3235F_Erase_t)index;
+    }
+  }
+  total_energy += best;
+  total_time   += (uint64_t)best_time * pProfile->EraseCount;
+
+  pAdvice->Energy = (uint32_t)(total_energy / 1000U);
+  pAdvice->Time   = (uint32_t)(total_time / 1000U);
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
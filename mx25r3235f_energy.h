@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_energy.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the energy and bandwidth cost
+  *          model of the MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_ENERGY_H
+#define MX25R3235F_ENERGY_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_Energy
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Energy_Exported_Constants MX25R3235F Energy Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Energy model defaults
+  *         Indicative typical values, to be set from the datasheet for the
+  *         supply voltage, power mode and clock in use.
+  */
+#define MX25R3235F_ENERGY_READ_CURRENT_1                2500U        /* Read current, 1 data line (uA)       */
+#define MX25R3235F_ENERGY_READ_CURRENT_2                3000U        /* Read current, 2 data lines (uA)      */
+#define MX25R3235F_ENERGY_READ_CURRENT_4                3500U        /* Read current, 4 data lines (uA)      */
+#define MX25R3235F_ENERGY_PROGRAM_CURRENT               3100U        /* Page program current (uA)            */
+#define MX25R3235F_ENERGY_ERASE_CURRENT                 3100U        /* Erase current (uA)                   */
+#define MX25R3235F_ENERGY_PROGRAM_TIME                  850U         /* Page program time, tPP (us)          */
+#define MX25R3235F_ENERGY_ERASE_4K_TIME                 40000U       /* Sector erase time, tSE (us)          */
+#define MX25R3235F_ENERGY_ERASE_32K_TIME                160000U      /* 32K block erase time, tBE32 (us)     */
+#define MX25R3235F_ENERGY_ERASE_64K_TIME                320000U      /* 64K block erase time, tBE (us)       */
+#define MX25R3235F_ENERGY_ERASE_CHIP_TIME               40000000U    /* Chip erase time, tCE (us)            */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Energy_Exported_Types MX25R3235F Energy Exported Types
+  * @{
+  */
+typedef struct {
+  uint32_t ClockFrequency;                                     /*!< XSPI clock frequency (kHz)                   */
+  uint32_t Voltage;                                            /*!< Supply voltage (mV)                          */
+  uint32_t ReadCurrent[MX25R3235F_INTERFACE_NUMBER];           /*!< Read current per interface mode (uA)         */
+  uint32_t ProgramCurrent;                                     /*!< Page program current (uA)                    */
+  uint32_t EraseCurrent;                                       /*!< Erase current (uA)                           */
+  uint32_t ProgramTime;                                        /*!< Page program time (us)                       */
+  uint32_t EraseTime[MX25R3235F_ERASE_CHIP + 1];               /*!< Erase time per MX25R3235F_Erase_t value (us) */
+} MX25R3235F_EnergyModel_t;
+
+typedef struct {
+  uint32_t Count;                                              /*!< Number of commands                           */
+  uint32_t Bytes;                                              /*!< Number of bytes read, programmed or erased   */
+  uint32_t Time;                                               /*!< Estimated busy time (ms)                     */
+  uint32_t Energy;                                             /*!< Estimated energy (uJ)                        */
+  uint32_t TimeFraction;                                       /*!< Busy time below 1 ms (us)                    */
+  uint32_t EnergyFraction;                                     /*!< Energy below 1 uJ (nJ)                       */
+} MX25R3235F_EnergyCounter_t;
+
+typedef struct {
+  MX25R3235F_EnergyModel_t   Model;                            /*!< Cost model                                   */
+  MX25R3235F_EnergyCounter_t Counter[MX25R3235F_TRACE_ERASE + 1]; /*!< Counters per MX25R3235F_TraceOperation_t  */
+} MX25R3235F_Energy_t;
+
+typedef struct {
+  uint32_t ReadSize;                                           /*!< Bytes per read                               */
+  uint32_t ReadCount;                                          /*!< Reads per period                             */
+  uint32_t WriteSize;                                          /*!< Bytes per program                            */
+  uint32_t WriteCount;                                         /*!< Programs per period                          */
+  uint32_t EraseSize;                                          /*!< Bytes per erase, 4K aligned                  */
+  uint32_t EraseCount;                                         /*!< Erases per period                            */
+} MX25R3235F_EnergyProfile_t;
+
+typedef struct {
+  MX25R3235F_Interface_t ReadMode;                             /*!< Cheapest read mode                           */
+  MX25R3235F_Interface_t ProgramMode;                          /*!< Cheapest program mode, SPI or QUAD_INOUT     */
+  MX25R3235F_Erase_t     Erase;                                /*!< Cheapest largest erase granularity           */
+  uint32_t               Energy;                               /*!< Estimated energy per period (uJ)             */
+  uint32_t               Time;                                 /*!< Estimated busy time per period (ms)          */
+} MX25R3235F_EnergyAdvice_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Energy_Exported_Functions MX25R3235F Energy Exported Functions
+  * @{
+  */
+/* Energy Model Commands ******************************************************/
+void    MX25R3235F_EnergyInit(MX25R3235F_Energy_t *pEnergy, uint32_t ClockFrequency, uint32_t Voltage);
+int32_t MX25R3235F_EnergyCost(const MX25R3235F_EnergyModel_t *pModel, MX25R3235F_TraceOperation_t Operation,
+                              MX25R3235F_Interface_t Mode, uint32_t Size, uint32_t *pTime, uint32_t *pEnergy);
+int32_t MX25R3235F_EnergyAccount(MX25R3235F_Energy_t *pEnergy, const MX25R3235F_TraceRecord_t *pRecord);
+int32_t MX25R3235F_EnergyAdvise(const MX25R3235F_EnergyModel_t *pModel, const MX25R3235F_EnergyProfile_t *pProfile,
+                                MX25R3235F_EnergyAdvice_t *pAdvice);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_ENERGY_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
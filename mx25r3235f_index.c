@@ -0,0 +1,403 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_index.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the flash-resident timestamp index on top of the
+ *          MX25R3235F XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_index.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Index MX25R3235F Timestamp Index
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Index_Private_Functions_Prototypes MX25R3235F Index Private Functions Prototypes
+  * @{
+  */
+static int32_t MX25R3235F_IndexRead(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Index_t *pIndex, uint32_t *pPosition,
+                                   uint32_t Backward, uint32_t *pTimestamp, uint32_t *pAddress);
+static int32_t MX25R3235F_IndexSearch(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Index_t *pIndex, uint32_t Timestamp,
+                                      uint32_t *pPosition);
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Index_Exported_Functions MX25R3235F Index Exported Functions
+  * @{
+  */
+
+/* Timestamp Index Commands ***************************************************/
+/**
+  * @brief  Mount a sparse timestamp index of a record log
+  * @param  Ctx Component object pointer
+  * @param  pIndex Timestamp index pointer
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @param  BaseAddress Address of the index region, 4K aligned
+  * @param  Size Size of the index region, multiple of 4K
+  * @param  Granularity Size of the indexed units of the log, page or sector
+  * @note   The index holds one entry (timestamp of the first record, unit)
+  *         per unit of the log, appended in timestamp order. The end of the
+  *         index is found by a binary search on the erased entries and only
+  *         a summary is kept in RAM. An entry torn by a power loss is
+  *         skipped by the searches.
+  * @retval error status
+  */
+int32_t MX25R3235F_IndexMount(XSPI_HandleTypeDef *Ctx, MX25R3235F_Index_t *pIndex, MX25R3235F_Interface_t Mode,
+                              uint32_t BaseAddress, uint32_t Size, uint32_t Granularity)
+{
+  uint8_t  entry[MX25R3235F_INDEX_ENTRY_SIZE];
+  uint32_t low = 0U;
+  uint32_t high = Size / MX25R3235F_INDEX_ENTRY_SIZE;
+  uint32_t middle;
+  uint32_t position;
+  uint32_t address;
+
+  if ((MX25R3235F_DEVICE_NUMBER != 1U) || (Size == 0U) || (((BaseAddress | Size) % MX25R3235F_SECTOR_4K) != 0U) ||
+      (Granularity < MX25R3235F_PAGE_SIZE))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pIndex->Mode        = Mode;
+  pIndex->BaseAddress = BaseAddress;
+  pIndex->Size        = Size;
+  pIndex->Granularity = Granularity;
+  pIndex->LastUnit    = MX25R3235F_INDEX_NONE;
+  pIndex->Blocked     = 0U;
+
+  /* First erased entry */
+  while (low < high)
+  {
+    middle = low + ((high - low) / 2U);
+    if (MX25R3235F_Read(Ctx, Mode, entry, BaseAddress + (middle * MX25R3235F_INDEX_ENTRY_SIZE),
+                        MX25R3235F_INDEX_ENTRY_SIZE) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if ((MX25R3235F_Get32(&entry[0]) & MX25R3235F_Get32(&entry[4])) == 0xFFFFFFFFU)
+    {
+      high = middle;
+    }
+    else
+    {
+      low = middle + 1U;
+    }
+  }
+  pIndex->Count = low;
+
+  /* Summary */
+  position = 0U;
+  if (MX25R3235F_IndexRead(Ctx, pIndex, &position, 0U, &pIndex->FirstTimestamp, &address) == MX25R3235F_OK)
+  {
+    position = pIndex->Count - 1U;
+    if (MX25R3235F_IndexRead(Ctx, pIndex, &position, 1U, &pIndex->LastTimestamp, &address) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+    pIndex->LastUnit = address / Granularity;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Erase a timestamp index
+  * @param  Ctx Component object pointer
+  * @param  pIndex Timestamp index pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_IndexFormat(XSPI_HandleTypeDef *Ctx, MX25R3235F_Index_t *pIndex)
+{
+  uint32_t offset;
+
+  for (offset = 0U; offset < pIndex->Size; offset += MX25R3235F_SECTOR_4K)
+  {
+    if ((MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK) ||
+        (MX25R3235F_BlockErase(Ctx, pIndex->BaseAddress + offset, MX25R3235F_ERASE_4K) != MX25R3235F_OK) ||
+        (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+  }
+
+  pIndex->Count    = 0U;
+  pIndex->LastUnit = MX25R3235F_INDEX_NONE;
+  pIndex->Blocked  = 0U;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Index a record appended to the log
+  * @param  Ctx Component object pointer
+  * @param  pIndex Timestamp index pointer
+  * @param  Timestamp Timestamp of the record, not lower than the previous one
+  * @param  Address Address of the record in the log
+  * @note   To be called for each record, or at least for the first record of
+  *         each unit: an entry is only written when the record starts a new
+  *         unit. When the entry program fails, the slot is overwritten with
+  *         zeros, an invalid entry skipped by the searches, so that no erased
+  *         hole cuts the index at the next mount. If that fails as well, the
+  *         appends are refused until the index is mounted again.
+  * @retval error status
+  */
+int32_t MX25R3235F_IndexAppend(XSPI_HandleTypeDef *Ctx, MX25R3235F_Index_t *pIndex, uint32_t Timestamp,
+                               uint32_t Address)
+{
+  uint8_t  entry[MX25R3235F_INDEX_ENTRY_SIZE];
+  uint32_t unit = Address / pIndex->Granularity;
+  uint32_t position = pIndex->Count;
+
+  if (unit == pIndex->LastUnit)
+  {
+    return MX25R3235F_OK;
+  }
+
+  if ((pIndex->Blocked != 0U) ||
+      ((pIndex->LastUnit != MX25R3235F_INDEX_NONE) && (Timestamp < pIndex->LastTimestamp)) ||
+      (position >= (pIndex->Size / MX25R3235F_INDEX_ENTRY_SIZE)))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  MX25R3235F_Put32(&entry[0], Timestamp);
+  entry[4] = (uint8_t)unit;
+  entry[5] = (uint8_t)(unit >> 8);
+  entry[6] = (uint8_t)(unit >> 16);
+  entry[7] = (uint8_t)~(entry[0] ^ entry[1] ^ entry[2] ^ entry[3] ^ entry[4] ^ entry[5] ^ entry[6]);
+
+  /* The slot is used even if the program fails */
+  pIndex->Count++;
+  if (MX25R3235F_Write(Ctx, pIndex->Mode, entry, pIndex->BaseAddress + (position * MX25R3235F_INDEX_ENTRY_SIZE),
+                       MX25R3235F_INDEX_ENTRY_SIZE, MX25R3235F_VERIFY_FAIL_FLAG, NULL) != MX25R3235F_OK)
+  {
+    /* Tombstone: the slot must not read as erased */
+    (void)memset(entry, 0, MX25R3235F_INDEX_ENTRY_SIZE);
+    if (MX25R3235F_Write(Ctx, pIndex->Mode, entry, pIndex->BaseAddress + (position * MX25R3235F_INDEX_ENTRY_SIZE),
+                         MX25R3235F_INDEX_ENTRY_SIZE, MX25R3235F_VERIFY_FAIL_FLAG, NULL) != MX25R3235F_OK)
+    {
+      pIndex->Blocked = 1U;
+    }
+    return MX25R3235F_ERROR;
+  }
+
+  if (pIndex->LastUnit == MX25R3235F_INDEX_NONE)
+  {
+    pIndex->FirstTimestamp = Timestamp;
+  }
+  pIndex->LastTimestamp = Timestamp;
+  pIndex->LastUnit      = unit;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Find the part of the log holding the records of a time range
+  * @param  Ctx Component object pointer
+  * @param  pIndex Timestamp index pointer
+  * @param  Start First timestamp of the range
+  * @param  End Last timestamp of the range
+  * @param  pStartAddr Returns the address of the first unit to read
+  * @param  pEndAddr Returns the address where to stop reading, or
+  *         MX25R3235F_INDEX_NONE to read up to the end of the log
+  * @note   The range starts with the last unit starting before Start, which
+  *         may end with records of the range, and ends before the first unit
+  *         starting after End. It is found with two binary searches on the
+  *         index; the records of the returned units are then filtered by the
+  *         application.
+  * @retval error status
+  */
+int32_t MX25R3235F_IndexFind(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Index_t *pIndex, uint32_t Start, uint32_t End,
+                             uint32_t *pStartAddr, uint32_t *pEndAddr)
+{
+  uint32_t position;
+  uint32_t timestamp;
+  uint32_t address;
+  uint32_t found;
+
+  if ((pIndex->LastUnit == MX25R3235F_INDEX_NONE) || (Start > End))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Last unit starting before Start, or the first unit */
+  if (MX25R3235F_IndexSearch(Ctx, pIndex, Start, &position) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  found = 0U;
+  if (position != 0U)
+  {
+    position--;
+    found = (MX25R3235F_IndexRead(Ctx, pIndex, &position, 1U, &timestamp, &address) == MX25R3235F_OK) ? 1U : 0U;
+  }
+
+  if (found == 0U)
+  {
+    position = 0U;
+    if (MX25R3235F_IndexRead(Ctx, pIndex, &position, 0U, &timestamp, &address) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+  }
+  *pStartAddr = address;
+
+  /* First unit starting after End */
+  *pEndAddr = MX25R3235F_INDEX_NONE;
+  if (End < pIndex->LastTimestamp)
+  {
+    if ((MX25R3235F_IndexSearch(Ctx, pIndex, End + 1U, &position) != MX25R3235F_OK) ||
+        (MX25R3235F_IndexRead(Ctx, pIndex, &position, 0U, &timestamp, &address) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+    *pEndAddr = address;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Index_Private_Functions MX25R3235F Index Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Read the nearest valid entry of a timestamp index.
+  * @param  Ctx Component object pointer
+  * @param  pIndex Timestamp index pointer
+  * @param  pPosition Entry position, updated with the position of the valid entry
+  * @param  Backward 1 to skip torn entries backward, 0 forward
+  * @param  pTimestamp Returns the timestamp
+  * @param  pAddress Returns the address of the unit
+  * @retval MX25R3235F_ERROR when there is no valid entry in that direction
+  */
+static int32_t MX25R3235F_IndexRead(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Index_t *pIndex, uint32_t *pPosition,
+                                   uint32_t Backward, uint32_t *pTimestamp, uint32_t *pAddress)
+{
+  uint8_t  entry[MX25R3235F_INDEX_ENTRY_SIZE];
+  uint32_t position = *pPosition;
+
+  while (position < pIndex->Count)
+  {
+    if (MX25R3235F_Read(Ctx, pIndex->Mode, entry, pIndex->BaseAddress + (position * MX25R3235F_INDEX_ENTRY_SIZE),
+                        MX25R3235F_INDEX_ENTRY_SIZE) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if (entry[7] == (uint8_t)~(entry[0] ^ entry[1] ^ entry[2] ^ entry[3] ^ entry[4] ^ entry[5] ^ entry[6]))
+    {
+      *pPosition  = position;
+      *pTimestamp = MX25R3235F_Get32(&entry[0]);
+      *pAddress   = (entry[4] | ((uint32_t)entry[5] << 8) | ((uint32_t)entry[6] << 16)) * pIndex->Granularity;
+      return MX25R3235F_OK;
+    }
+
+    /* Position 0 wraps to an out of range value backward */
+    position = (Backward != 0U) ? (position - 1U) : (position + 1U);
+  }
+
+  return MX25R3235F_ERROR;
+}
+
+/**
+  * @brief  Binary search of the first valid index entry not before a timestamp.
+  * @param  Ctx Component object pointer
+  * @param  pIndex Timestamp index pointer
+  * @param  Timestamp Timestamp searched
+  * @param  pPosition Returns the position of the entry, pIndex->Count if none
+  * @retval error status
+  */
+static int32_t MX25R3235F_IndexSearch(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Index_t *pIndex, uint32_t Timestamp,
+                                      uint32_t *pPosition)
+{
+  uint32_t low = 0U;
+  uint32_t high = pIndex->Count;
+  uint32_t middle;
+  uint32_t position;
+  uint32_t timestamp;
+  uint32_t address;
+  uint32_t found;
+
+  *pPosition = pIndex->Count;
+
+  while (low < high)
+  {
+    middle   = low + ((high - low) / 2U);
+    position = middle;
+
+    /* Torn entries are skipped forward, up to high */
+    found = ((MX25R3235F_IndexRead(Ctx, pIndex, &position, 0U, &timestamp, &address) == MX25R3235F_OK) &&
+             (position < high)) ? 1U : 0U;
+
+    if ((found != 0U) && (timestamp < Timestamp))
+    {
+      low = position + 1U;
+    }
+    else
+    {
+      if (found != 0U)
+      {
+        *pPosition = position;
+      }
+      high = middle;
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
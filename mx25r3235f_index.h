@@ -0,0 +1,118 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_index.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the flash-resident timestamp
+  *          index of the MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_INDEX_H
+#define MX25R3235F_INDEX_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_Index
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Index_Exported_Constants MX25R3235F Index Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Timestamp index configuration
+  */
+#define MX25R3235F_INDEX_ENTRY_SIZE                     8U           /* Timestamp, unit (24 bits), check     */
+#define MX25R3235F_INDEX_NONE                           0xFFFFFFFFU  /* No unit / end of the log             */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Index_Exported_Types MX25R3235F Index Exported Types
+  * @{
+  */
+typedef struct {
+  MX25R3235F_Interface_t Mode;                                 /*!< Interface mode                               */
+  uint32_t BaseAddress;                                        /*!< Address of the index region                  */
+  uint32_t Size;                                               /*!< Size of the index region                     */
+  uint32_t Granularity;                                        /*!< Size of the indexed units (page or sector)   */
+  uint32_t Count;                                              /*!< Number of entries written                    */
+  uint32_t FirstTimestamp;                                     /*!< Timestamp of the first entry                 */
+  uint32_t LastTimestamp;                                      /*!< Timestamp of the last entry                  */
+  uint32_t LastUnit;                                           /*!< Unit of the last entry, MX25R3235F_INDEX_NONE */
+  uint32_t Blocked;                                            /*!< Appends refused until the next mount         */
+} MX25R3235F_Index_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Index_Exported_Functions MX25R3235F Index Exported Functions
+  * @{
+  */
+/* Timestamp Index Commands ***************************************************/
+int32_t MX25R3235F_IndexMount(XSPI_HandleTypeDef *Ctx, MX25R3235F_Index_t *pIndex, MX25R3235F_Interface_t Mode,
+                              uint32_t BaseAddress, uint32_t Size, uint32_t Granularity);
+int32_t MX25R3235F_IndexFormat(XSPI_HandleTypeDef *Ctx, MX25R3235F_Index_t *pIndex);
+int32_t MX25R3235F_IndexAppend(XSPI_HandleTypeDef *Ctx, MX25R3235F_Index_t *pIndex, uint32_t Timestamp,
+                               uint32_t Address);
+int32_t MX25R3235F_IndexFind(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Index_t *pIndex, uint32_t Start, uint32_t End,
+                             uint32_t *pStartAddr, uint32_t *pEndAddr);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_INDEX_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
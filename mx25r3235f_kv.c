@@ -0,0 +1,508 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_kv.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the power-fail safe key-value store on top of the
+ *          MX25R3235F XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_kv.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_KV MX25R3235F Key-Value Store
+  * @{
+  */
+
+/** @defgroup MX25R3235F_KV_Private_Functions_Prototypes MX25R3235F KV Private Functions Prototypes
+  * @{
+  */
+static uint32_t MX25R3235F_KVFind(const MX25R3235F_KV_t *pKV, uint16_t Key);
+static void    MX25R3235F_KVEncode(uint8_t *pEntry, uint16_t Key, uint8_t Length, const uint8_t *pValue);
+static int32_t MX25R3235F_KVApply(MX25R3235F_KV_t *pKV, const uint8_t *pEntry);
+static int32_t MX25R3235F_KVAppend(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV, uint8_t *pEntry);
+static int32_t MX25R3235F_KVCompact(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV);
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_KV_Exported_Functions MX25R3235F KV Exported Functions
+  * @{
+  */
+
+/* Key-Value Store Commands ***************************************************/
+/**
+  * @brief  Mount the key-value store
+  * @param  Ctx Component object pointer
+  * @param  pKV Key-value store pointer
+  * @param  BaseAddress Address of the two 4K sectors used by the store
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @param  pTable RAM index, one item per key
+  * @param  TableSize Number of items of the RAM index, power of 2
+  * @note   The log of the active sector is replayed in the RAM index. The
+  *         store is formatted when no valid sector is found. A log holding
+  *         more than MX25R3235F_KV_MAX_KEYS keys is rejected: they could not
+  *         be compacted with room left for the next entry.
+  * @retval error status
+  */
+int32_t MX25R3235F_KVMount(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV, uint32_t BaseAddress,
+                           MX25R3235F_Interface_t Mode, MX25R3235F_KVItem_t *pTable, uint32_t TableSize)
+{
+  uint8_t  page[MX25R3235F_PAGE_SIZE];
+  uint32_t sequence[2] = {0U, 0U};
+  uint32_t valid[2];
+  uint32_t index;
+  uint32_t offset;
+  uint32_t slot;
+
+  if ((MX25R3235F_DEVICE_NUMBER != 1U) || (TableSize < 2U) || ((TableSize & (TableSize - 1U)) != 0U) ||
+      ((BaseAddress % MX25R3235F_SECTOR_4K) != 0U))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pKV->BaseAddress = BaseAddress;
+  pKV->Mode        = Mode;
+  pKV->pTable      = pTable;
+  pKV->TableSize   = TableSize;
+  pKV->Count       = 0U;
+
+  for (index = 0U; index < TableSize; index++)
+  {
+    pTable[index].Key = MX25R3235F_KV_KEY_ERASED;
+  }
+
+  /* Find the active sector: valid header with the most recent sequence */
+  for (index = 0U; index < 2U; index++)
+  {
+    if (MX25R3235F_Read(Ctx, Mode, page, BaseAddress + (index * MX25R3235F_SECTOR_4K), MX25R3235F_KV_ENTRY_SIZE) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    valid[index] = ((MX25R3235F_Get32(&page[0]) == MX25R3235F_KV_MAGIC) && (MX25R3235F_Get32(&page[8]) == 0U)) ? 1U : 0U;
+    sequence[index] = MX25R3235F_Get32(&page[4]);
+  }
+
+  if ((valid[0] == 0U) && (valid[1] == 0U))
+  {
+    /* No store: format with an empty log */
+    pKV->Sector   = BaseAddress + MX25R3235F_SECTOR_4K;
+    pKV->Sequence = 0U;
+    return MX25R3235F_KVCompact(Ctx, pKV);
+  }
+
+  index = ((valid[1] != 0U) && ((valid[0] == 0U) || ((int32_t)(sequence[1] - sequence[0]) > 0))) ? 1U : 0U;
+
+  pKV->Sector      = BaseAddress + (index * MX25R3235F_SECTOR_4K);
+  pKV->Sequence    = sequence[index];
+  pKV->WriteOffset = MX25R3235F_SECTOR_4K;
+
+  /* Replay the log up to the first erased entry */
+  for (offset = 0U; offset < MX25R3235F_SECTOR_4K; offset += MX25R3235F_PAGE_SIZE)
+  {
+    if (MX25R3235F_Read(Ctx, Mode, page, pKV->Sector + offset, MX25R3235F_PAGE_SIZE) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    for (slot = (offset == 0U) ? MX25R3235F_KV_ENTRY_SIZE : 0U; slot < MX25R3235F_PAGE_SIZE; slot += MX25R3235F_KV_ENTRY_SIZE)
+    {
+      /* An entry fully erased marks the end of the log */
+      index = 0U;
+      while ((index < MX25R3235F_KV_ENTRY_SIZE) && (page[slot + index] == 0xFFU))
+      {
+        index++;
+      }
+
+      if (index == MX25R3235F_KV_ENTRY_SIZE)
+      {
+        pKV->WriteOffset = offset + slot;
+        return (pKV->Count <= MX25R3235F_KV_MAX_KEYS) ? MX25R3235F_OK : MX25R3235F_ERROR;
+      }
+
+      if (MX25R3235F_KVApply(pKV, &page[slot]) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+    }
+  }
+
+  return (pKV->Count <= MX25R3235F_KV_MAX_KEYS) ? MX25R3235F_OK : MX25R3235F_ERROR;
+}
+
+/**
+  * @brief  Set the value of a key
+  * @param  Ctx Component object pointer
+  * @param  pKV Key-value store pointer
+  * @param  Key Key, any value but MX25R3235F_KV_KEY_ERASED
+  * @param  pValue Pointer to the value
+  * @param  Length Length of the value, up to MX25R3235F_KV_VALUE_SIZE
+  * @note   Costs a single page program, or nothing when the value is unchanged.
+  *         The live entries are moved to the other sector when the active one
+  *         is full. A new key is rejected beyond MX25R3235F_KV_MAX_KEYS keys.
+  * @retval error status
+  */
+int32_t MX25R3235F_KVSet(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV, uint16_t Key, const uint8_t *pValue, uint32_t Length)
+{
+  MX25R3235F_KVItem_t *item;
+  uint8_t entry[MX25R3235F_KV_ENTRY_SIZE];
+
+  if ((Key == MX25R3235F_KV_KEY_ERASED) || (Length > MX25R3235F_KV_VALUE_SIZE))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  item = &pKV->pTable[MX25R3235F_KVFind(pKV, Key)];
+
+  if (item->Key == Key)
+  {
+    if ((item->Length == Length) && (memcmp(item->Value, pValue, Length) == 0))
+    {
+      return MX25R3235F_OK;
+    }
+  }
+  else if ((pKV->Count >= (pKV->TableSize - 1U)) || (pKV->Count >= MX25R3235F_KV_MAX_KEYS))
+  {
+    return MX25R3235F_ERROR;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  MX25R3235F_KVEncode(entry, Key, (uint8_t)Length, pValue);
+
+  if (MX25R3235F_KVAppend(Ctx, pKV, entry) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_KVApply(pKV, entry);
+}
+
+/**
+  * @brief  Get the value of a key
+  * @param  pKV Key-value store pointer
+  * @param  Key Key
+  * @param  pValue Pointer to the value, MX25R3235F_KV_VALUE_SIZE bytes
+  * @param  pLength Pointer to the length of the value
+  * @note   Served from the RAM index, without any memory access.
+  * @retval error status, MX25R3235F_ERROR when the key is not found
+  */
+int32_t MX25R3235F_KVGet(const MX25R3235F_KV_t *pKV, uint16_t Key, uint8_t *pValue, uint32_t *pLength)
+{
+  const MX25R3235F_KVItem_t *item = &pKV->pTable[MX25R3235F_KVFind(pKV, Key)];
+
+  if ((Key == MX25R3235F_KV_KEY_ERASED) || (item->Key != Key))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  (void)memcpy(pValue, item->Value, item->Length);
+  *pLength = item->Length;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Delete a key
+  * @param  Ctx Component object pointer
+  * @param  pKV Key-value store pointer
+  * @param  Key Key
+  * @retval error status
+  */
+int32_t MX25R3235F_KVDelete(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV, uint16_t Key)
+{
+  uint8_t entry[MX25R3235F_KV_ENTRY_SIZE];
+
+  if ((Key == MX25R3235F_KV_KEY_ERASED) || (pKV->pTable[MX25R3235F_KVFind(pKV, Key)].Key != Key))
+  {
+    return MX25R3235F_OK;
+  }
+
+  MX25R3235F_KVEncode(entry, Key, MX25R3235F_KV_DELETED, NULL);
+
+  if (MX25R3235F_KVAppend(Ctx, pKV, entry) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_KVApply(pKV, entry);
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_KV_Private_Functions MX25R3235F KV Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Find the RAM index slot of a key (linear probing).
+  * @param  pKV Key-value store pointer
+  * @param  Key Key
+  * @retval Slot holding the key, or first free slot when the key is absent
+  */
+static uint32_t MX25R3235F_KVFind(const MX25R3235F_KV_t *pKV, uint16_t Key)
+{
+  uint32_t mask = pKV->TableSize - 1U;
+  uint32_t slot = (((uint32_t)Key * 0x9E3779B1U) >> 16) & mask;
+
+  while ((pKV->pTable[slot].Key != Key) && (pKV->pTable[slot].Key != MX25R3235F_KV_KEY_ERASED))
+  {
+    slot = (slot + 1U) & mask;
+  }
+
+  return slot;
+}
+
+/**
+  * @brief  Build a log entry.
+  * @param  pEntry Pointer to the entry, MX25R3235F_KV_ENTRY_SIZE bytes
+  * @param  Key Key
+  * @param  Length Length of the value, or MX25R3235F_KV_DELETED
+  * @param  pValue Pointer to the value
+  * @retval None
+  */
+static void MX25R3235F_KVEncode(uint8_t *pEntry, uint16_t Key, uint8_t Length, const uint8_t *pValue)
+{
+  /* Key (2), length (1), reserved (1), value (8), CRC-32 (4) */
+  (void)memset(pEntry, 0xFF, MX25R3235F_KV_ENTRY_SIZE);
+  pEntry[0] = (uint8_t)Key;
+  pEntry[1] = (uint8_t)(Key >> 8);
+  pEntry[2] = Length;
+
+  if (Length <= MX25R3235F_KV_VALUE_SIZE)
+  {
+    (void)memcpy(&pEntry[4], pValue, Length);
+  }
+
+  MX25R3235F_Put32(&pEntry[12], MX25R3235F_CRC32(0U, pEntry, 12U));
+}
+
+/**
+  * @brief  Apply a log entry to the RAM index.
+  * @param  pKV Key-value store pointer
+  * @param  pEntry Pointer to the entry
+  * @note   Entries with a wrong CRC (interrupted program) are ignored.
+  * @retval error status
+  */
+static int32_t MX25R3235F_KVApply(MX25R3235F_KV_t *pKV, const uint8_t *pEntry)
+{
+  MX25R3235F_KVItem_t *table = pKV->pTable;
+  uint32_t mask = pKV->TableSize - 1U;
+  uint16_t key  = (uint16_t)pEntry[0] | (uint16_t)((uint16_t)pEntry[1] << 8);
+  uint32_t slot;
+  uint32_t next;
+  uint32_t home;
+
+  if ((MX25R3235F_Get32(&pEntry[12]) != MX25R3235F_CRC32(0U, pEntry, 12U)) || (key == MX25R3235F_KV_KEY_ERASED) ||
+      ((pEntry[2] > MX25R3235F_KV_VALUE_SIZE) && (pEntry[2] != MX25R3235F_KV_DELETED)))
+  {
+    return MX25R3235F_OK;
+  }
+
+  slot = MX25R3235F_KVFind(pKV, key);
+
+  if (pEntry[2] != MX25R3235F_KV_DELETED)
+  {
+    if (table[slot].Key != key)
+    {
+      if (pKV->Count >= mask)
+      {
+        return MX25R3235F_ERROR;
+      }
+      pKV->Count++;
+    }
+
+    table[slot].Key    = key;
+    table[slot].Length = pEntry[2];
+    (void)memcpy(table[slot].Value, &pEntry[4], MX25R3235F_KV_VALUE_SIZE);
+  }
+  else if (table[slot].Key == key)
+  {
+    /* Remove the key and shift back the following items of the probe chain */
+    next = slot;
+    for (;;)
+    {
+      next = (next + 1U) & mask;
+      if (table[next].Key == MX25R3235F_KV_KEY_ERASED)
+      {
+        break;
+      }
+
+      home = (((uint32_t)table[next].Key * 0x9E3779B1U) >> 16) & mask;
+      if (((next - home) & mask) >= ((next - slot) & mask))
+      {
+        table[slot] = table[next];
+        slot = next;
+      }
+    }
+
+    table[slot].Key = MX25R3235F_KV_KEY_ERASED;
+    pKV->Count--;
+  }
+  else
+  {
+    /* Deleted key not present */
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Append an entry to the log of the active sector.
+  * @param  Ctx Component object pointer
+  * @param  pKV Key-value store pointer
+  * @param  pEntry Pointer to the entry
+  * @retval error status
+  */
+static int32_t MX25R3235F_KVAppend(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV, uint8_t *pEntry)
+{
+  uint32_t address;
+
+  if (pKV->WriteOffset >= MX25R3235F_SECTOR_4K)
+  {
+    if (MX25R3235F_KVCompact(Ctx, pKV) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if (pKV->WriteOffset >= MX25R3235F_SECTOR_4K)
+    {
+      return MX25R3235F_ERROR;
+    }
+  }
+
+  /* The slot is consumed even if the program fails */
+  address = pKV->Sector + pKV->WriteOffset;
+  pKV->WriteOffset += MX25R3235F_KV_ENTRY_SIZE;
+
+  return MX25R3235F_Write(Ctx, pKV->Mode, pEntry, address, MX25R3235F_KV_ENTRY_SIZE, MX25R3235F_VERIFY_NONE, NULL);
+}
+
+/**
+  * @brief  Move the live entries to the other sector and make it active.
+  * @param  Ctx Component object pointer
+  * @param  pKV Key-value store pointer
+  * @note   The new sector is only valid once its header state is programmed
+  *         to 0, after all the entries: an interrupted compaction leaves the
+  *         previous sector active.
+  * @retval error status
+  */
+static int32_t MX25R3235F_KVCompact(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV)
+{
+  uint8_t  page[MX25R3235F_PAGE_SIZE];
+  uint8_t  state[4] = {0U, 0U, 0U, 0U};
+  uint32_t sector;
+  uint32_t offset = 0U;
+  uint32_t length = MX25R3235F_KV_ENTRY_SIZE;
+  uint32_t index;
+
+  sector = (pKV->Sector == pKV->BaseAddress) ? (pKV->BaseAddress + MX25R3235F_SECTOR_4K) : pKV->BaseAddress;
+
+  if (MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_BlockErase(Ctx, sector, MX25R3235F_ERASE_4K) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Header: magic, sequence, state (erased until the copy is complete) */
+  (void)memset(page, 0xFF, MX25R3235F_PAGE_SIZE);
+  MX25R3235F_Put32(&page[0], MX25R3235F_KV_MAGIC);
+  MX25R3235F_Put32(&page[4], pKV->Sequence + 1U);
+
+  for (index = 0U; index <= pKV->TableSize; index++)
+  {
+    if ((length == MX25R3235F_PAGE_SIZE) || ((index == pKV->TableSize) && (length != 0U)))
+    {
+      if (MX25R3235F_Write(Ctx, pKV->Mode, page, sector + offset, length, MX25R3235F_VERIFY_NONE, NULL) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      offset += length;
+      length  = 0U;
+    }
+
+    if ((index < pKV->TableSize) && (pKV->pTable[index].Key != MX25R3235F_KV_KEY_ERASED))
+    {
+      if ((offset + length) >= MX25R3235F_SECTOR_4K)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      MX25R3235F_KVEncode(&page[length], pKV->pTable[index].Key, pKV->pTable[index].Length, pKV->pTable[index].Value);
+      length += MX25R3235F_KV_ENTRY_SIZE;
+    }
+  }
+
+  /* Commit: the new sector becomes the active one */
+  if (MX25R3235F_Write(Ctx, pKV->Mode, state, sector + 8U, 4U, MX25R3235F_VERIFY_NONE, NULL) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pKV->Sector      = sector;
+  pKV->Sequence   += 1U;
+  pKV->WriteOffset = offset;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,125 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_kv.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the power-fail safe key-value
+  *          store of the MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_KV_H
+#define MX25R3235F_KV_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_KV
+  * @{
+  */
+
+/** @defgroup MX25R3235F_KV_Exported_Constants MX25R3235F KV Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Key-value store configuration
+  */
+#define MX25R3235F_KV_ENTRY_SIZE                        16U          /* Log entry size, 16 entries per page  */
+#define MX25R3235F_KV_VALUE_SIZE                        8U           /* Maximum value size                   */
+#define MX25R3235F_KV_KEY_ERASED                        0xFFFFU      /* Reserved key (erased entry)          */
+#define MX25R3235F_KV_DELETED                           0xFEU        /* Length of a deleted key entry        */
+#define MX25R3235F_KV_MAGIC                             0x3130564BU  /* Sector header magic, "KV01"          */
+#define MX25R3235F_KV_MAX_KEYS                          254U         /* Keys compacted with a free entry     */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_KV_Exported_Types MX25R3235F KV Exported Types
+  * @{
+  */
+typedef struct {
+  uint16_t Key;                                                /*!< Key, MX25R3235F_KV_KEY_ERASED when free      */
+  uint8_t  Length;                                             /*!< Length of the value                          */
+  uint8_t  Value[MX25R3235F_KV_VALUE_SIZE];                    /*!< Value                                        */
+} MX25R3235F_KVItem_t;
+
+typedef struct {
+  uint32_t               BaseAddress;                          /*!< Address of the two sectors of the store      */
+  MX25R3235F_Interface_t Mode;                                 /*!< Interface mode                               */
+  MX25R3235F_KVItem_t    *pTable;                              /*!< RAM index                                    */
+  uint32_t               TableSize;                            /*!< Number of items of the RAM index             */
+  uint32_t               Count;                                /*!< Number of keys                               */
+  uint32_t               Sector;                               /*!< Address of the active sector                 */
+  uint32_t               Sequence;                             /*!< Sequence number of the active sector         */
+  uint32_t               WriteOffset;                          /*!< Offset of the next entry in the sector       */
+} MX25R3235F_KV_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_KV_Exported_Functions MX25R3235F KV Exported Functions
+  * @{
+  */
+/* Key-Value Store Commands ***************************************************/
+int32_t MX25R3235F_KVMount(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV, uint32_t BaseAddress,
+                           MX25R3235F_Interface_t Mode, MX25R3235F_KVItem_t *pTable, uint32_t TableSize);
+int32_t MX25R3235F_KVSet(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV, uint16_t Key, const uint8_t *pValue, uint32_t Length);
+int32_t MX25R3235F_KVGet(const MX25R3235F_KV_t *pKV, uint16_t Key, uint8_t *pValue, uint32_t *pLength);
+int32_t MX25R3235F_KVDelete(XSPI_HandleTypeDef *Ctx, MX25R3235F_KV_t *pKV, uint16_t Key);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_KV_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
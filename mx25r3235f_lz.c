@@ -0,0 +1,403 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_lz.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the compressed storage on top of the MX25R3235F
+ *          XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_lz.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_LZ MX25R3235F Compressed Storage
+  * @{
+  */
+
+/** @defgroup MX25R3235F_LZ_Private_Types MX25R3235F LZ Private Types
+  * @{
+  */
+typedef struct {
+  uint8_t  *pOut;                                              /*!< Output frame buffer                          */
+  uint32_t Size;                                               /*!< Expected output size                         */
+  uint32_t Position;                                           /*!< Current output position                      */
+  uint32_t Stored;                                             /*!< Frame stored without compression             */
+  uint32_t Error;                                              /*!< Corrupted stream detected                    */
+  uint8_t  Flags;                                              /*!< Current flags byte                           */
+  uint8_t  Bits;                                               /*!< Items left in the current flags byte         */
+  uint8_t  Pending;                                            /*!< First byte of a match split across chunks    */
+  uint8_t  HasPending;                                         /*!< Pending field valid                          */
+} MX25R3235F_LZDecoder_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_LZ_Private_Functions_Prototypes MX25R3235F LZ Private Functions Prototypes
+  * @{
+  */
+static uint32_t MX25R3235F_LZCompress(const uint8_t *pIn, uint32_t Size, uint8_t *pOut, uint32_t MaxSize);
+static void    MX25R3235F_LZCallback(void *pArg, const uint8_t *pData, uint32_t Size);
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_LZ_Exported_Functions MX25R3235F LZ Exported Functions
+  * @{
+  */
+
+/* Compressed Storage Commands ************************************************/
+/**
+  * @brief  Compress and write data as a sequence of page aligned frames
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @param  pData Pointer to data to be written
+  * @param  Size Size of data to write
+  * @param  WriteAddr Write start address, page aligned, in an erased area
+  * @param  pIndex Frame index, receives the address of each frame
+  *         (one entry per MX25R3235F_LZ_FRAME_SIZE bytes of data)
+  * @param  pWork Working buffer of MX25R3235F_LZ_WORK_SIZE bytes
+  * @param  pNextAddr Page aligned address following the last frame. Can be NULL.
+  * @note   Each frame holds MX25R3235F_LZ_FRAME_SIZE bytes of data (less for
+  *         the last one) and is compressed independently, so that any frame
+  *         can be decompressed alone. Frames which do not shrink are stored.
+  * @retval error status
+  */
+int32_t MX25R3235F_LZWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint8_t *pData, uint32_t Size,
+                           uint32_t WriteAddr, uint32_t *pIndex, uint8_t *pWork, uint32_t *pNextAddr)
+{
+  uint32_t length;
+  uint32_t compressed;
+
+  if ((WriteAddr % MX25R3235F_PAGE_SIZE) != 0U)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  while (Size > 0U)
+  {
+    length = (Size < MX25R3235F_LZ_FRAME_SIZE) ? Size : MX25R3235F_LZ_FRAME_SIZE;
+
+    compressed = MX25R3235F_LZCompress(pData, length, &pWork[MX25R3235F_LZ_HEADER_SIZE], length - 1U);
+    if (compressed == 0U)
+    {
+      (void)memcpy(&pWork[MX25R3235F_LZ_HEADER_SIZE], pData, length);
+      compressed = length;
+    }
+
+    /* Header: data size, payload size, CRC-32 of the data */
+    MX25R3235F_Put32(&pWork[0], length | (compressed << 16));
+    MX25R3235F_Put32(&pWork[4], MX25R3235F_CRC32(0U, pData, length));
+
+    if (MX25R3235F_Write(Ctx, Mode, pWork, WriteAddr, MX25R3235F_LZ_HEADER_SIZE + compressed,
+                         MX25R3235F_VERIFY_NONE, NULL) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    *pIndex = WriteAddr;
+    pIndex++;
+
+    WriteAddr += (MX25R3235F_LZ_HEADER_SIZE + compressed + MX25R3235F_PAGE_SIZE - 1U) & ~(MX25R3235F_PAGE_SIZE - 1U);
+    pData     += length;
+    Size      -= length;
+  }
+
+  if (pNextAddr != NULL)
+  {
+    *pNextAddr = WriteAddr;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Read data written by MX25R3235F_LZWrite()
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  pIndex Frame index filled by MX25R3235F_LZWrite()
+  * @param  Offset Offset of the data to read, from the start of the written data
+  * @param  pData Pointer to data to be read
+  * @param  Size Size of data to read
+  * @param  pFrame Frame buffer of MX25R3235F_LZ_FRAME_SIZE bytes
+  * @param  pBuffer Pointer to the read working buffer
+  * @param  BufferSize Size of the read working buffer
+  * @note   Only the frames covering the requested range are read. Each frame
+  *         is decompressed chunk by chunk as it is received (overlapped with
+  *         the reception of the next chunk when MX25R3235F_USE_DMA is set),
+  *         then checked against its CRC.
+  * @retval error status
+  */
+int32_t MX25R3235F_LZRead(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint32_t *pIndex, uint32_t Offset,
+                          uint8_t *pData, uint32_t Size, uint8_t *pFrame, uint8_t *pBuffer, uint32_t BufferSize)
+{
+  MX25R3235F_LZDecoder_t decoder;
+  uint8_t  header[MX25R3235F_LZ_HEADER_SIZE];
+  uint32_t frame;
+  uint32_t start;
+  uint32_t length;
+  uint32_t compressed;
+
+  while (Size > 0U)
+  {
+    frame = pIndex[Offset / MX25R3235F_LZ_FRAME_SIZE];
+    start = Offset % MX25R3235F_LZ_FRAME_SIZE;
+
+    if (MX25R3235F_Read(Ctx, Mode, header, frame, MX25R3235F_LZ_HEADER_SIZE) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    (void)memset(&decoder, 0, sizeof(decoder));
+    decoder.pOut = pFrame;
+    decoder.Size = MX25R3235F_Get32(&header[0]) & 0xFFFFU;
+    compressed   = MX25R3235F_Get32(&header[0]) >> 16;
+    decoder.Stored = (compressed == decoder.Size) ? 1U : 0U;
+
+    if ((decoder.Size > MX25R3235F_LZ_FRAME_SIZE) || (compressed > decoder.Size) || (start >= decoder.Size))
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if (MX25R3235F_ReadStream(Ctx, Mode, frame + MX25R3235F_LZ_HEADER_SIZE, compressed, pBuffer, BufferSize,
+                              MX25R3235F_LZCallback, &decoder) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if ((decoder.Error != 0U) || (decoder.Position != decoder.Size) ||
+        (MX25R3235F_CRC32(0U, pFrame, decoder.Size) != MX25R3235F_Get32(&header[4])))
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    length = decoder.Size - start;
+    if (length > Size)
+    {
+      length = Size;
+    }
+
+    (void)memcpy(pData, &pFrame[start], length);
+
+    pData  += length;
+    Offset += length;
+    Size   -= length;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_LZ_Private_Functions MX25R3235F LZ Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Compress a frame (LZSS, 4K window).
+  * @param  pIn Pointer to the data
+  * @param  Size Size of the data, up to MX25R3235F_LZ_FRAME_SIZE
+  * @param  pOut Pointer to the compressed data
+  * @param  MaxSize Maximum size of the compressed data
+  * @note   Each flags byte describes the next 8 items, LSB first: 1 for a
+  *         literal byte, 0 for a 2-byte match (12-bit distance minus 1, 4-bit
+  *         length minus 3).
+  * @retval Compressed size, 0 when it would exceed MaxSize
+  */
+static uint32_t MX25R3235F_LZCompress(const uint8_t *pIn, uint32_t Size, uint8_t *pOut, uint32_t MaxSize)
+{
+  uint16_t head[MX25R3235F_LZ_HASH_SIZE];
+  uint32_t in = 0U;
+  uint32_t out = 0U;
+  uint32_t flags = 0U;
+  uint32_t bits = 8U;
+  uint32_t hash;
+  uint32_t candidate;
+  uint32_t length;
+  uint32_t distance;
+
+  (void)memset(head, 0xFF, sizeof(head));
+
+  while (in < Size)
+  {
+    if (bits == 8U)
+    {
+      if (out >= MaxSize)
+      {
+        return 0U;
+      }
+      flags = out;
+      pOut[out] = 0U;
+      out++;
+      bits = 0U;
+    }
+
+    /* Longest match at the last position with the same 3-byte hash */
+    length = 0U;
+    candidate = 0xFFFFU;
+    if ((in + 3U) <= Size)
+    {
+      hash = MX25R3235F_LZ_HASH(&pIn[in]);
+      candidate = head[hash];
+      head[hash] = (uint16_t)in;
+    }
+
+    if (candidate != 0xFFFFU)
+    {
+      while ((length < MX25R3235F_LZ_MATCH_MAX) && ((in + length) < Size) && (pIn[candidate + length] == pIn[in + length]))
+      {
+        length++;
+      }
+    }
+
+    if (length >= MX25R3235F_LZ_MATCH_MIN)
+    {
+      if ((out + 2U) > MaxSize)
+      {
+        return 0U;
+      }
+
+      distance = in - candidate - 1U;
+      pOut[out]      = (uint8_t)distance;
+      pOut[out + 1U] = (uint8_t)(((distance >> 8) << 4) | (length - MX25R3235F_LZ_MATCH_MIN));
+      out += 2U;
+
+      /* Index the positions covered by the match */
+      for (in++, length--; length > 0U; in++, length--)
+      {
+        if ((in + 3U) <= Size)
+        {
+          head[MX25R3235F_LZ_HASH(&pIn[in])] = (uint16_t)in;
+        }
+      }
+    }
+    else
+    {
+      if (out >= MaxSize)
+      {
+        return 0U;
+      }
+
+      pOut[flags] |= (uint8_t)(1U << bits);
+      pOut[out] = pIn[in];
+      out++;
+      in++;
+    }
+
+    bits++;
+  }
+
+  return out;
+}
+
+/**
+  * @brief  Read stream callback decompressing a chunk of a frame.
+  * @param  pArg Pointer to the decoder state
+  * @param  pData Pointer to the chunk
+  * @param  Size Size of the chunk
+  * @retval None
+  */
+static void MX25R3235F_LZCallback(void *pArg, const uint8_t *pData, uint32_t Size)
+{
+  MX25R3235F_LZDecoder_t *decoder = (MX25R3235F_LZDecoder_t *)pArg;
+  uint32_t index;
+  uint32_t distance;
+  uint32_t length;
+
+  for (index = 0U; (index < Size) && (decoder->Error == 0U) && (decoder->Position < decoder->Size); index++)
+  {
+    if (decoder->Stored != 0U)
+    {
+      decoder->pOut[decoder->Position] = pData[index];
+      decoder->Position++;
+    }
+    else if (decoder->Bits == 0U)
+    {
+      decoder->Flags = pData[index];
+      decoder->Bits  = 8U;
+    }
+    else if ((decoder->Flags & 1U) != 0U)
+    {
+      decoder->pOut[decoder->Position] = pData[index];
+      decoder->Position++;
+      decoder->Flags >>= 1;
+      decoder->Bits--;
+    }
+    else if (decoder->HasPending == 0U)
+    {
+      decoder->Pending    = pData[index];
+      decoder->HasPending = 1U;
+    }
+    else
+    {
+      distance = ((uint32_t)decoder->Pending | ((uint32_t)(pData[index] >> 4) << 8)) + 1U;
+      length   = ((uint32_t)pData[index] & 0x0FU) + MX25R3235F_LZ_MATCH_MIN;
+
+      if ((distance > decoder->Position) || (length > (decoder->Size - decoder->Position)))
+      {
+        decoder->Error = 1U;
+      }
+      else
+      {
+        /* Byte copy: the match can overlap the output */
+        for (; length > 0U; length--)
+        {
+          decoder->pOut[decoder->Position] = decoder->pOut[decoder->Position - distance];
+          decoder->Position++;
+        }
+      }
+
+      decoder->HasPending = 0U;
+      decoder->Flags >>= 1;
+      decoder->Bits--;
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_lz.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the compressed storage of the
+  *          MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_LZ_H
+#define MX25R3235F_LZ_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_LZ
+  * @{
+  */
+
+/** @defgroup MX25R3235F_LZ_Exported_Constants MX25R3235F LZ Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Compressed storage configuration
+  */
+#define MX25R3235F_LZ_FRAME_SIZE                        4096U        /* Data per frame, also the LZ window   */
+#define MX25R3235F_LZ_HEADER_SIZE                       8U           /* Frame header size                    */
+#define MX25R3235F_LZ_WORK_SIZE                         (MX25R3235F_LZ_HEADER_SIZE + MX25R3235F_LZ_FRAME_SIZE)
+#define MX25R3235F_LZ_MATCH_MIN                         3U           /* Shortest match                       */
+#define MX25R3235F_LZ_MATCH_MAX                         18U          /* Longest match                        */
+#define MX25R3235F_LZ_HASH_SIZE                         256U         /* Match finder hash table entries      */
+#define MX25R3235F_LZ_HASH(p)                           ((((((uint32_t)(p)[0] << 8) ^ (uint32_t)(p)[1]) << 8) ^ \
+                                                          (uint32_t)(p)[2]) * 2654435761U >> 24)
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_LZ_Exported_Functions MX25R3235F LZ Exported Functions
+  * @{
+  */
+/* Compressed Storage Commands ************************************************/
+int32_t MX25R3235F_LZWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint8_t *pData, uint32_t Size,
+                           uint32_t WriteAddr, uint32_t *pIndex, uint8_t *pWork, uint32_t *pNextAddr);
+int32_t MX25R3235F_LZRead(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint32_t *pIndex, uint32_t Offset,
+                          uint8_t *pData, uint32_t Size, uint8_t *pFrame, uint8_t *pBuffer, uint32_t BufferSize);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_LZ_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,535 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_pool.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the pool of pre-erased sectors on top of the
+ *          MX25R3235F XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_pool.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Pool MX25R3235F Pre-Erased Sector Pool
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Pool_Private_Functions_Prototypes MX25R3235F Pool Private Functions Prototypes
+  * @{
+  */
+static uint32_t MX25R3235F_PoolLog(const MX25R3235F_Pool_t *pPool);
+static uint32_t MX25R3235F_PoolGet(const MX25R3235F_Pool_t *pPool, uint32_t Sector);
+static void    MX25R3235F_PoolSet(MX25R3235F_Pool_t *pPool, uint32_t Sector, uint32_t State);
+static int32_t MX25R3235F_PoolUpdate(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool, uint32_t Sector, uint32_t State);
+static int32_t MX25R3235F_PoolCompact(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool);
+static int32_t MX25R3235F_PoolErase(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool);
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Pool_Exported_Functions MX25R3235F Pool Exported Functions
+  * @{
+  */
+
+/* Pre-Erased Sector Pool Commands ********************************************/
+/**
+  * @brief  Mount a pool of sectors kept erased in the background
+  * @param  Ctx Component object pointer
+  * @param  pPool Sector pool pointer
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @param  LogAddress Address of the two 4K sectors holding the pool state
+  * @param  BaseAddress Address of the first sector of the pool
+  * @param  SectorCount Number of sectors, up to MX25R3235F_POOL_MAX_SECTORS
+  * @param  Target Number of sectors to keep erased ahead of allocation, 0 to
+  *         only erase in the foreground at allocation
+  * @note   Each sector is dirty (to be erased), ready (erased), used or bad.
+  *         The state is kept in RAM and persisted as a snapshot followed by
+  *         a log of changes, so ready sectors survive a reset. On the first
+  *         mount all the sectors are dirty.
+  * @retval error status
+  */
+int32_t MX25R3235F_PoolMount(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool, MX25R3235F_Interface_t Mode,
+                             uint32_t LogAddress, uint32_t BaseAddress, uint32_t SectorCount, uint32_t Target)
+{
+  uint8_t  buffer[MX25R3235F_PAGE_SIZE];
+  uint32_t sequence[2] = {0U, 0U};
+  uint32_t valid[2] = {0U, 0U};
+  uint32_t index;
+  uint32_t offset;
+  uint32_t size;
+  uint32_t sector;
+  uint8_t  *entry;
+
+  if ((MX25R3235F_DEVICE_NUMBER != 1U) || (SectorCount == 0U) || (SectorCount > MX25R3235F_POOL_MAX_SECTORS) ||
+      (Target > SectorCount) || (((LogAddress | BaseAddress) % MX25R3235F_SECTOR_4K) != 0U))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  (void)memset(pPool, 0, sizeof(MX25R3235F_Pool_t));
+  pPool->Mode        = Mode;
+  pPool->LogAddress  = LogAddress;
+  pPool->BaseAddress = BaseAddress;
+  pPool->SectorCount = SectorCount;
+  pPool->Target      = Target;
+  pPool->Erasing     = MX25R3235F_POOL_NONE;
+
+  /* Header: magic, sequence */
+  for (index = 0U; index < 2U; index++)
+  {
+    if (MX25R3235F_Read(Ctx, Mode, buffer, LogAddress + (index * MX25R3235F_SECTOR_4K), 8U) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    valid[index]    = (MX25R3235F_Get32(&buffer[0]) == MX25R3235F_POOL_MAGIC) ? 1U : 0U;
+    sequence[index] = MX25R3235F_Get32(&buffer[4]);
+  }
+
+  if ((valid[0] == 0U) && (valid[1] == 0U))
+  {
+    /* First mount: all sectors dirty */
+    pPool->LogSector = 1U;
+    return MX25R3235F_PoolCompact(Ctx, pPool);
+  }
+
+  pPool->LogSector = ((valid[1] != 0U) && ((valid[0] == 0U) || ((int32_t)(sequence[1] - sequence[0]) > 0))) ? 1U : 0U;
+  pPool->Sequence  = sequence[pPool->LogSector];
+
+  /* Snapshot, then the log entries up to the first erased one */
+  if (MX25R3235F_Read(Ctx, Mode, pPool->State, MX25R3235F_PoolLog(pPool) + 8U, sizeof(pPool->State)) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pPool->WriteOffset = MX25R3235F_SECTOR_4K;
+  for (offset = MX25R3235F_POOL_LOG_OFFSET; offset < MX25R3235F_SECTOR_4K; offset += size)
+  {
+    size = ((MX25R3235F_SECTOR_4K - offset) < MX25R3235F_PAGE_SIZE) ? (MX25R3235F_SECTOR_4K - offset) : MX25R3235F_PAGE_SIZE;
+    if (MX25R3235F_Read(Ctx, Mode, buffer, MX25R3235F_PoolLog(pPool) + offset, size) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    for (index = 0U; index < size; index += MX25R3235F_POOL_ENTRY_SIZE)
+    {
+      entry = &buffer[index];
+      if (MX25R3235F_Get32(entry) == 0xFFFFFFFFU)
+      {
+        pPool->WriteOffset = offset + index;
+        break;
+      }
+
+      /* Sector, state, check: entries torn by a power loss are skipped */
+      sector = entry[0] | ((uint32_t)entry[1] << 8);
+      if ((entry[3] == (uint8_t)~(entry[0] ^ entry[1] ^ entry[2])) && (sector < SectorCount) &&
+          (entry[2] <= MX25R3235F_POOL_BAD))
+      {
+        MX25R3235F_PoolSet(pPool, sector, entry[2]);
+      }
+    }
+
+    if (pPool->WriteOffset != MX25R3235F_SECTOR_4K)
+    {
+      break;
+    }
+  }
+
+  for (sector = 0U; sector < SectorCount; sector++)
+  {
+    pPool->ReadyCount += (MX25R3235F_PoolGet(pPool, sector) == MX25R3235F_POOL_READY) ? 1U : 0U;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Get an erased sector from the pool
+  * @param  Ctx Component object pointer
+  * @param  pPool Sector pool pointer
+  * @param  pAddress Returns the address of the sector
+  * @note   A ready sector is returned at once. When none is ready, a dirty
+  *         sector is erased in the foreground.
+  * @retval error status
+  */
+int32_t MX25R3235F_PoolAllocate(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool, uint32_t *pAddress)
+{
+  uint32_t sector = 0U;
+  uint32_t index;
+
+  while (pPool->ReadyCount == 0U)
+  {
+    /* Foreground erase, whatever the target */
+    if (pPool->Erasing == MX25R3235F_POOL_NONE)
+    {
+      if (MX25R3235F_PoolErase(Ctx, pPool) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      if (pPool->Erasing == MX25R3235F_POOL_NONE)
+      {
+        /* Nothing left to erase */
+        return MX25R3235F_ERROR;
+      }
+    }
+
+    if ((MX25R3235F_PoolResume(Ctx, pPool) != MX25R3235F_OK) ||
+        (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK) ||
+        (MX25R3235F_PoolProcess(Ctx, pPool) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+  }
+
+  for (index = 0U; index < pPool->SectorCount; index++)
+  {
+    sector = (pPool->Next + index) % pPool->SectorCount;
+    if (MX25R3235F_PoolGet(pPool, sector) == MX25R3235F_POOL_READY)
+    {
+      break;
+    }
+  }
+
+  if (MX25R3235F_PoolUpdate(Ctx, pPool, sector, MX25R3235F_POOL_USED) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pPool->Next = (sector + 1U) % pPool->SectorCount;
+  *pAddress   = pPool->BaseAddress + (sector * MX25R3235F_SECTOR_4K);
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Give a sector back to the pool, to be erased in the background
+  * @param  Ctx Component object pointer
+  * @param  pPool Sector pool pointer
+  * @param  Address Address of the sector
+  * @retval error status
+  */
+int32_t MX25R3235F_PoolRelease(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool, uint32_t Address)
+{
+  uint32_t sector = (Address - pPool->BaseAddress) / MX25R3235F_SECTOR_4K;
+
+  if ((Address < pPool->BaseAddress) || (sector >= pPool->SectorCount) ||
+      (MX25R3235F_PoolGet(pPool, sector) != MX25R3235F_POOL_USED))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  return MX25R3235F_PoolUpdate(Ctx, pPool, sector, MX25R3235F_POOL_DIRTY);
+}
+
+/**
+  * @brief  Run the background erase of the pool
+  * @param  Ctx Component object pointer
+  * @param  pPool Sector pool pointer
+  * @note   To be called in idle time. It never waits for an erase: it records
+  *         the end of the running erase, if any, and starts the erase of the
+  *         next dirty sector while fewer than Target sectors are ready. The
+  *         application suspends the running erase with MX25R3235F_PoolSuspend()
+  *         to access the memory, and lets it continue with MX25R3235F_PoolResume().
+  * @retval error status
+  */
+int32_t MX25R3235F_PoolProcess(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool)
+{
+  uint32_t sector;
+  uint8_t  reg;
+
+  if (pPool->Erasing != MX25R3235F_POOL_NONE)
+  {
+    if ((pPool->Suspended != 0U) || (MX25R3235F_ReadStatusRegister(Ctx, &reg) != MX25R3235F_OK))
+    {
+      return (pPool->Suspended != 0U) ? MX25R3235F_OK : MX25R3235F_ERROR;
+    }
+
+    if ((reg & MX25R3235F_SR_WIP) != 0U)
+    {
+      return MX25R3235F_OK;
+    }
+
+    if (MX25R3235F_ReadSecurityRegister(Ctx, &reg) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    sector         = pPool->Erasing;
+    pPool->Erasing = MX25R3235F_POOL_NONE;
+
+    if (MX25R3235F_PoolUpdate(Ctx, pPool, sector, ((reg & MX25R3235F_SECR_E_FAIL) != 0U) ?
+                              MX25R3235F_POOL_BAD : MX25R3235F_POOL_READY) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+  }
+
+  if (pPool->ReadyCount >= pPool->Target)
+  {
+    return MX25R3235F_OK;
+  }
+
+  return MX25R3235F_PoolErase(Ctx, pPool);
+}
+
+/**
+  * @brief  Suspend the background erase of the pool, if running
+  * @param  Ctx Component object pointer
+  * @param  pPool Sector pool pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_PoolSuspend(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool)
+{
+  if ((pPool->Erasing == MX25R3235F_POOL_NONE) || (pPool->Suspended != 0U))
+  {
+    return MX25R3235F_OK;
+  }
+
+  if ((MX25R3235F_Suspend(Ctx) != MX25R3235F_OK) ||
+      (MX25R3235F_AutoPollingMemReady(Ctx, HAL_XSPI_TIMEOUT_DEFAULT_VALUE) != MX25R3235F_OK))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pPool->Suspended = 1U;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Resume the background erase of the pool, if suspended
+  * @param  Ctx Component object pointer
+  * @param  pPool Sector pool pointer
+  * @retval error status
+  */
+int32_t MX25R3235F_PoolResume(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool)
+{
+  if (pPool->Suspended == 0U)
+  {
+    return MX25R3235F_OK;
+  }
+
+  pPool->Suspended = 0U;
+
+  return MX25R3235F_Resume(Ctx);
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Pool_Private_Functions MX25R3235F Pool Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Address of the active log sector of a pool.
+  * @param  pPool Sector pool pointer
+  * @retval Address
+  */
+static uint32_t MX25R3235F_PoolLog(const MX25R3235F_Pool_t *pPool)
+{
+  return pPool->LogAddress + (pPool->LogSector * MX25R3235F_SECTOR_4K);
+}
+
+/**
+  * @brief  Get the state of a pool sector.
+  * @param  pPool Sector pool pointer
+  * @param  Sector Sector index in the pool
+  * @retval State
+  */
+static uint32_t MX25R3235F_PoolGet(const MX25R3235F_Pool_t *pPool, uint32_t Sector)
+{
+  return ((uint32_t)pPool->State[Sector / 4U] >> ((Sector % 4U) * 2U)) & 0x3U;
+}
+
+/**
+  * @brief  Set the state of a pool sector in RAM.
+  * @param  pPool Sector pool pointer
+  * @param  Sector Sector index in the pool
+  * @param  State New state
+  * @retval None
+  */
+static void MX25R3235F_PoolSet(MX25R3235F_Pool_t *pPool, uint32_t Sector, uint32_t State)
+{
+  uint32_t shift = (Sector % 4U) * 2U;
+
+  pPool->State[Sector / 4U] = (uint8_t)((pPool->State[Sector / 4U] & ~(0x3U << shift)) | (State << shift));
+}
+
+/**
+  * @brief  Change the state of a pool sector and log it.
+  * @param  Ctx Component object pointer
+  * @param  pPool Sector pool pointer
+  * @param  Sector Sector index in the pool
+  * @param  State New state
+  * @note   The background erase, if running, is suspended during the log
+  *         program. A full log is compacted into the other log sector.
+  * @retval error status
+  */
+static int32_t MX25R3235F_PoolUpdate(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool, uint32_t Sector, uint32_t State)
+{
+  uint8_t  entry[MX25R3235F_POOL_ENTRY_SIZE];
+  uint32_t suspended = pPool->Suspended;
+  int32_t  ret;
+
+  pPool->ReadyCount -= (MX25R3235F_PoolGet(pPool, Sector) == MX25R3235F_POOL_READY) ? 1U : 0U;
+  pPool->ReadyCount += (State == MX25R3235F_POOL_READY) ? 1U : 0U;
+  MX25R3235F_PoolSet(pPool, Sector, State);
+
+  if (pPool->WriteOffset >= MX25R3235F_SECTOR_4K)
+  {
+    return MX25R3235F_PoolCompact(Ctx, pPool);
+  }
+
+  entry[0] = (uint8_t)Sector;
+  entry[1] = (uint8_t)(Sector >> 8);
+  entry[2] = (uint8_t)State;
+  entry[3] = (uint8_t)~(entry[0] ^ entry[1] ^ entry[2]);
+
+  if (MX25R3235F_PoolSuspend(Ctx, pPool) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  ret = MX25R3235F_Write(Ctx, pPool->Mode, entry, MX25R3235F_PoolLog(pPool) + pPool->WriteOffset,
+                         MX25R3235F_POOL_ENTRY_SIZE, MX25R3235F_VERIFY_FAIL_FLAG, NULL);
+  pPool->WriteOffset += MX25R3235F_POOL_ENTRY_SIZE;
+
+  if ((suspended == 0U) && (MX25R3235F_PoolResume(Ctx, pPool) != MX25R3235F_OK))
+  {
+    ret = MX25R3235F_ERROR;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Write the pool state as a snapshot in the other log sector.
+  * @param  Ctx Component object pointer
+  * @param  pPool Sector pool pointer
+  * @note   The running erase is completed first. The header is written last:
+  *         the previous log stays valid until the snapshot is complete.
+  * @retval error status
+  */
+static int32_t MX25R3235F_PoolCompact(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool)
+{
+  uint8_t  header[8];
+  uint32_t address = pPool->LogAddress + ((pPool->LogSector ^ 1U) * MX25R3235F_SECTOR_4K);
+
+  if (pPool->Erasing != MX25R3235F_POOL_NONE)
+  {
+    if ((MX25R3235F_PoolResume(Ctx, pPool) != MX25R3235F_OK) ||
+        (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK) ||
+        (MX25R3235F_ReadSecurityRegister(Ctx, &header[0]) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    pPool->ReadyCount += ((header[0] & MX25R3235F_SECR_E_FAIL) == 0U) ? 1U : 0U;
+    MX25R3235F_PoolSet(pPool, pPool->Erasing, ((header[0] & MX25R3235F_SECR_E_FAIL) != 0U) ?
+                       MX25R3235F_POOL_BAD : MX25R3235F_POOL_READY);
+    pPool->Erasing = MX25R3235F_POOL_NONE;
+  }
+
+  if ((MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK) ||
+      (MX25R3235F_BlockErase(Ctx, address, MX25R3235F_ERASE_4K) != MX25R3235F_OK) ||
+      (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  MX25R3235F_Put32(&header[0], MX25R3235F_POOL_MAGIC);
+  MX25R3235F_Put32(&header[4], pPool->Sequence + 1U);
+
+  if ((MX25R3235F_Write(Ctx, pPool->Mode, pPool->State, address + 8U, sizeof(pPool->State),
+                        MX25R3235F_VERIFY_READBACK, NULL) != MX25R3235F_OK) ||
+      (MX25R3235F_Write(Ctx, pPool->Mode, header, address, 8U, MX25R3235F_VERIFY_READBACK, NULL) != MX25R3235F_OK))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pPool->LogSector  ^= 1U;
+  pPool->Sequence   += 1U;
+  pPool->WriteOffset = MX25R3235F_POOL_LOG_OFFSET;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Start the erase of the next dirty sector of the pool, if any.
+  * @param  Ctx Component object pointer
+  * @param  pPool Sector pool pointer
+  * @note   No erase must be running.
+  * @retval error status
+  */
+static int32_t MX25R3235F_PoolErase(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool)
+{
+  uint32_t sector;
+  uint32_t index;
+
+  for (index = 0U; index < pPool->SectorCount; index++)
+  {
+    sector = (pPool->Next + index) % pPool->SectorCount;
+    if (MX25R3235F_PoolGet(pPool, sector) == MX25R3235F_POOL_DIRTY)
+    {
+      if ((MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK) ||
+          (MX25R3235F_BlockErase(Ctx, pPool->BaseAddress + (sector * MX25R3235F_SECTOR_4K), MX25R3235F_ERASE_4K) != MX25R3235F_OK))
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      pPool->Erasing = sector;
+      break;
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_pool.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the pool of pre-erased
+  *          sectors of the MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_POOL_H
+#define MX25R3235F_POOL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_Pool
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Pool_Exported_Constants MX25R3235F Pool Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Pre-erased sector pool configuration
+  */
+#define MX25R3235F_POOL_MAX_SECTORS                     256U         /* Max sectors in a pool                */
+#define MX25R3235F_POOL_MAGIC                           0x314C4F50U  /* Pool log header magic, "POL1"        */
+#define MX25R3235F_POOL_LOG_OFFSET                      (8U + (MX25R3235F_POOL_MAX_SECTORS / 4U)) /* First log entry */
+#define MX25R3235F_POOL_ENTRY_SIZE                      4U           /* Log entry size                       */
+#define MX25R3235F_POOL_DIRTY                           0U           /* Sector to be erased                  */
+#define MX25R3235F_POOL_READY                           1U           /* Sector erased, not allocated         */
+#define MX25R3235F_POOL_USED                            2U           /* Sector allocated                     */
+#define MX25R3235F_POOL_BAD                             3U           /* Sector failed to erase               */
+#define MX25R3235F_POOL_NONE                            0xFFFFFFFFU  /* No erase running                     */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Pool_Exported_Types MX25R3235F Pool Exported Types
+  * @{
+  */
+typedef struct {
+  MX25R3235F_Interface_t Mode;                                 /*!< Interface mode                               */
+  uint32_t LogAddress;                                         /*!< Address of the two log sectors               */
+  uint32_t BaseAddress;                                        /*!< Address of the first pool sector             */
+  uint32_t SectorCount;                                        /*!< Number of pool sectors                       */
+  uint32_t Target;                                             /*!< Number of sectors to keep erased             */
+  uint32_t ReadyCount;                                         /*!< Number of erased sectors                     */
+  uint32_t Next;                                               /*!< Next sector to consider, for rotation        */
+  uint32_t Erasing;                                            /*!< Sector being erased, MX25R3235F_POOL_NONE    */
+  uint32_t Suspended;                                          /*!< Erase suspended                              */
+  uint32_t LogSector;                                          /*!< Active log sector, 0 or 1                    */
+  uint32_t Sequence;                                           /*!< Sequence number of the active log sector     */
+  uint32_t WriteOffset;                                        /*!< Offset of the next log entry                 */
+  uint8_t  State[MX25R3235F_POOL_MAX_SECTORS / 4U];            /*!< State of each sector, 2 bits per sector      */
+} MX25R3235F_Pool_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Pool_Exported_Functions MX25R3235F Pool Exported Functions
+  * @{
+  */
+/* Pre-Erased Sector Pool Commands ********************************************/
+int32_t MX25R3235F_PoolMount(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool, MX25R3235F_Interface_t Mode,
+                             uint32_t LogAddress, uint32_t BaseAddress, uint32_t SectorCount, uint32_t Target);
+int32_t MX25R3235F_PoolAllocate(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool, uint32_t *pAddress);
+int32_t MX25R3235F_PoolRelease(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool, uint32_t Address);
+int32_t MX25R3235F_PoolProcess(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool);
+int32_t MX25R3235F_PoolSuspend(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool);
+int32_t MX25R3235F_PoolResume(XSPI_HandleTypeDef *Ctx, MX25R3235F_Pool_t *pPool);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_POOL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
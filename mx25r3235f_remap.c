@@ -0,0 +1,583 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_remap.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the bad sector remapping on top of the MX25R3235F
+ *          XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_remap.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Remap MX25R3235F Sector Remapping
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Remap_Private_Functions_Prototypes MX25R3235F Remap Private Functions Prototypes
+  * @{
+  */
+static void    MX25R3235F_RemapAssign(MX25R3235F_Remap_t *pRemap, uint32_t Sector, uint32_t Spare);
+static int32_t MX25R3235F_RemapRetire(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, uint32_t Sector,
+                                      uint32_t SkipOffset, uint32_t SkipSize);
+static int32_t MX25R3235F_RemapRecord(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, uint32_t Sector, uint32_t Spare);
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Remap_Exported_Functions MX25R3235F Remap Exported Functions
+  * @{
+  */
+
+/* Sector Remapping Commands **************************************************/
+/**
+  * @brief  Load the bad sector remapping table
+  * @param  Ctx Component object pointer
+  * @param  pRemap Remapping context pointer
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @param  TableAddress Address of the 4K sector holding the remapping table
+  * @param  SpareAddress Address of the first 4K spare sector
+  * @param  SpareCount Number of spare sectors, up to MX25R3235F_REMAP_MAX_SPARES
+  * @note   The table and the spare sectors are reserved: they must lie outside
+  *         the area accessed through the remapping functions, and the table
+  *         sector must be erased before its first use.
+  * @retval error status
+  */
+int32_t MX25R3235F_RemapMount(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, MX25R3235F_Interface_t Mode,
+                              uint32_t TableAddress, uint32_t SpareAddress, uint32_t SpareCount)
+{
+  uint8_t  buffer[MX25R3235F_PAGE_SIZE];
+  uint32_t offset;
+  uint32_t index;
+  uint16_t sector;
+  uint16_t spare;
+  uint8_t  *entry;
+
+  if ((MX25R3235F_DEVICE_NUMBER != 1U) || (SpareCount > MX25R3235F_REMAP_MAX_SPARES) ||
+      (((TableAddress | SpareAddress) % MX25R3235F_SECTOR_4K) != 0U))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  (void)memset(pRemap, 0, sizeof(MX25R3235F_Remap_t));
+  pRemap->Mode         = Mode;
+  pRemap->TableAddress = TableAddress;
+  pRemap->SpareAddress = SpareAddress;
+  pRemap->SpareCount   = SpareCount;
+  pRemap->WriteOffset  = MX25R3235F_SECTOR_4K;
+  for (index = 0U; index < MX25R3235F_REMAP_MAX_SPARES; index++)
+  {
+    pRemap->Spare[index] = MX25R3235F_REMAP_FREE;
+  }
+
+  /* Replay the entries up to the first erased one */
+  for (offset = 0U; offset < MX25R3235F_SECTOR_4K; offset += MX25R3235F_REMAP_ENTRY_SIZE)
+  {
+    if ((offset % MX25R3235F_PAGE_SIZE) == 0U)
+    {
+      if (MX25R3235F_Read(Ctx, Mode, buffer, TableAddress + offset, MX25R3235F_PAGE_SIZE) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+    }
+
+    entry  = &buffer[offset % MX25R3235F_PAGE_SIZE];
+    sector = (uint16_t)(entry[2] | ((uint16_t)entry[3] << 8));
+    spare  = (uint16_t)(entry[4] | ((uint16_t)entry[5] << 8));
+
+    if (MX25R3235F_Get32(entry) == 0xFFFFFFFFU)
+    {
+      pRemap->WriteOffset = offset;
+      break;
+    }
+
+    /* Entries torn by a power loss are skipped */
+    if ((entry[0] == MX25R3235F_REMAP_MAGIC) && (entry[1] == (uint8_t)~MX25R3235F_REMAP_MAGIC) &&
+        ((entry[6] | ((uint32_t)entry[7] << 8)) == (MX25R3235F_CRC32(0U, entry, 6U) & 0xFFFFU)) &&
+        (spare < SpareCount))
+    {
+      if (sector == MX25R3235F_REMAP_BAD)
+      {
+        /* Only a free spare fails: every retired sector stays held by a spare */
+        if (pRemap->Spare[spare] < MX25R3235F_REMAP_BAD)
+        {
+          return MX25R3235F_ERROR;
+        }
+        pRemap->Spare[spare] = MX25R3235F_REMAP_BAD;
+      }
+      else if (sector < (MX25R3235F_FLASH_SIZE / MX25R3235F_SECTOR_4K))
+      {
+        MX25R3235F_RemapAssign(pRemap, sector, spare);
+      }
+      else
+      {
+        /* Unknown entry */
+      }
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Get the physical address of a logical address
+  * @param  pRemap Remapping context pointer
+  * @param  Address Logical address
+  * @note   Healthy sectors cost a single bitmap test.
+  * @retval Physical address, MX25R3235F_REMAP_NO_ADDRESS for a retired sector
+  *         held by no spare sector (corrupted context)
+  */
+uint32_t MX25R3235F_RemapAddress(const MX25R3235F_Remap_t *pRemap, uint32_t Address)
+{
+  uint32_t sector = Address / MX25R3235F_SECTOR_4K;
+  uint32_t index;
+
+  if ((pRemap->Retired[sector / 32U] & (1UL << (sector % 32U))) == 0U)
+  {
+    return Address;
+  }
+
+  /* Bounded by the size of the spare pool */
+  for (index = 0U; index < pRemap->SpareCount; index++)
+  {
+    if (pRemap->Spare[index] == sector)
+    {
+      return pRemap->SpareAddress + (index * MX25R3235F_SECTOR_4K) + (Address % MX25R3235F_SECTOR_4K);
+    }
+  }
+
+  return MX25R3235F_REMAP_NO_ADDRESS;
+}
+
+/**
+  * @brief  Read an amount of data through the remapping table
+  * @param  Ctx Component object pointer
+  * @param  pRemap Remapping context pointer
+  * @param  pData Pointer to data to be read
+  * @param  ReadAddr Logical read start address
+  * @param  Size Size of data to read
+  * @note   The read is sent as a single command while no sector is retired.
+  * @retval error status
+  */
+int32_t MX25R3235F_RemapRead(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Remap_t *pRemap, uint8_t *pData,
+                             uint32_t ReadAddr, uint32_t Size)
+{
+  uint32_t length;
+  uint32_t address;
+
+  if (pRemap->Count == 0U)
+  {
+    return MX25R3235F_Read(Ctx, pRemap->Mode, pData, ReadAddr, Size);
+  }
+
+  while (Size > 0U)
+  {
+    length = MX25R3235F_SECTOR_4K - (ReadAddr % MX25R3235F_SECTOR_4K);
+    if (length > Size)
+    {
+      length = Size;
+    }
+
+    address = MX25R3235F_RemapAddress(pRemap, ReadAddr);
+    if ((address == MX25R3235F_REMAP_NO_ADDRESS) ||
+        (MX25R3235F_Read(Ctx, pRemap->Mode, pData, address, length) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    pData    += length;
+    ReadAddr += length;
+    Size     -= length;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Write an amount of data through the remapping table
+  * @param  Ctx Component object pointer
+  * @param  pRemap Remapping context pointer
+  * @param  pData Pointer to data to be written
+  * @param  WriteAddr Logical write start address
+  * @param  Size Size of data to write
+  * @note   When a page program fails (P_FAIL), the sector is retired: its
+  *         content is moved to a spare sector and the write is done there.
+  * @retval error status
+  */
+int32_t MX25R3235F_RemapWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, uint8_t *pData,
+                              uint32_t WriteAddr, uint32_t Size)
+{
+  uint32_t length;
+  uint32_t address;
+  uint32_t fail_addr;
+  int32_t  ret;
+
+  while (Size > 0U)
+  {
+    length = MX25R3235F_SECTOR_4K - (WriteAddr % MX25R3235F_SECTOR_4K);
+    if (length > Size)
+    {
+      length = Size;
+    }
+
+    do
+    {
+      address = MX25R3235F_RemapAddress(pRemap, WriteAddr);
+      if (address == MX25R3235F_REMAP_NO_ADDRESS)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      ret = MX25R3235F_Write(Ctx, pRemap->Mode, pData, address, length, MX25R3235F_VERIFY_FAIL_FLAG_SKIP_ERASED,
+                             &fail_addr);
+      if (ret != MX25R3235F_OK)
+      {
+        /* Communication error, or no spare sector left */
+        if ((fail_addr == 0xFFFFFFFFU) ||
+            (MX25R3235F_RemapRetire(Ctx, pRemap, WriteAddr / MX25R3235F_SECTOR_4K,
+                                    WriteAddr % MX25R3235F_SECTOR_4K, length) != MX25R3235F_OK))
+        {
+          return MX25R3235F_ERROR;
+        }
+      }
+    } while (ret != MX25R3235F_OK);
+
+    pData     += length;
+    WriteAddr += length;
+    Size      -= length;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Erase a sector or block through the remapping table
+  * @param  Ctx Component object pointer
+  * @param  pRemap Remapping context pointer
+  * @param  BlockAddress Logical address of the sector or block
+  * @param  BlockSize Erase size, 4K, 32K or 64K
+  * @note   Blocks without retired sectors are erased with a single command.
+  *         When an erase fails (E_FAIL), each sector is erased on its own and
+  *         the failing ones are retired to erased spare sectors.
+  * @retval error status
+  */
+int32_t MX25R3235F_RemapErase(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, uint32_t BlockAddress,
+                              MX25R3235F_Erase_t BlockSize)
+{
+  uint32_t size;
+  uint32_t sector;
+  uint32_t address;
+  uint32_t retired = 0U;
+  uint8_t  secr;
+
+  switch (BlockSize)
+  {
+  case MX25R3235F_ERASE_4K :
+    size = MX25R3235F_SECTOR_4K;
+    break;
+
+  case MX25R3235F_ERASE_32K :
+    size = MX25R3235F_BLOCK_32K;
+    break;
+
+  case MX25R3235F_ERASE_64K :
+    size = MX25R3235F_BLOCK_64K;
+    break;
+
+  default :
+    return MX25R3235F_ERROR;
+  }
+
+  BlockAddress -= BlockAddress % size;
+  for (sector = BlockAddress / MX25R3235F_SECTOR_4K; sector < ((BlockAddress + size) / MX25R3235F_SECTOR_4K); sector++)
+  {
+    retired |= pRemap->Retired[sector / 32U] & (1UL << (sector % 32U));
+  }
+
+  if (retired == 0U)
+  {
+    if ((MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK) ||
+        (MX25R3235F_BlockErase(Ctx, BlockAddress, BlockSize) != MX25R3235F_OK) ||
+        (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_BLOCK_64K_ERASE_MAX_TIME) != MX25R3235F_OK) ||
+        (MX25R3235F_ReadSecurityRegister(Ctx, &secr) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if ((secr & MX25R3235F_SECR_E_FAIL) == 0U)
+    {
+      return MX25R3235F_OK;
+    }
+  }
+
+  /* Sector by sector, retiring the failing ones */
+  for (sector = BlockAddress / MX25R3235F_SECTOR_4K; sector < ((BlockAddress + size) / MX25R3235F_SECTOR_4K); sector++)
+  {
+    do
+    {
+      address = MX25R3235F_RemapAddress(pRemap, sector * MX25R3235F_SECTOR_4K);
+      if ((address == MX25R3235F_REMAP_NO_ADDRESS) ||
+          (MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK) ||
+          (MX25R3235F_BlockErase(Ctx, address, MX25R3235F_ERASE_4K) != MX25R3235F_OK) ||
+          (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK) ||
+          (MX25R3235F_ReadSecurityRegister(Ctx, &secr) != MX25R3235F_OK))
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      if (((secr & MX25R3235F_SECR_E_FAIL) != 0U) &&
+          (MX25R3235F_RemapRetire(Ctx, pRemap, sector, 0U, MX25R3235F_SECTOR_4K) != MX25R3235F_OK))
+      {
+        return MX25R3235F_ERROR;
+      }
+    } while ((secr & MX25R3235F_SECR_E_FAIL) != 0U);
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Remap_Private_Functions MX25R3235F Remap Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Map a logical sector to a spare sector in the RAM table.
+  * @param  pRemap Remapping context pointer
+  * @param  Sector Logical sector index
+  * @param  Spare Spare sector index
+  * @note   The spare previously used by the sector, if any, is marked bad.
+  * @retval None
+  */
+static void MX25R3235F_RemapAssign(MX25R3235F_Remap_t *pRemap, uint32_t Sector, uint32_t Spare)
+{
+  uint32_t index;
+
+  if ((pRemap->Retired[Sector / 32U] & (1UL << (Sector % 32U))) == 0U)
+  {
+    pRemap->Retired[Sector / 32U] |= (1UL << (Sector % 32U));
+    pRemap->Count++;
+  }
+  else
+  {
+    for (index = 0U; index < pRemap->SpareCount; index++)
+    {
+      if (pRemap->Spare[index] == Sector)
+      {
+        pRemap->Spare[index] = MX25R3235F_REMAP_BAD;
+      }
+    }
+  }
+
+  pRemap->Spare[Spare] = (uint16_t)Sector;
+}
+
+/**
+  * @brief  Move a failing sector to a free spare sector and record it.
+  * @param  Ctx Component object pointer
+  * @param  pRemap Remapping context pointer
+  * @param  Sector Logical sector index
+  * @param  SkipOffset Offset in the sector of the area not to copy
+  * @param  SkipSize Size of the area not to copy, MX25R3235F_SECTOR_4K for none
+  * @note   The content of the failing sector outside the skipped area is
+  *         copied page by page. Spares failing in turn are marked bad, in
+  *         the table as well so that they stay out of use after a remount.
+  * @retval error status
+  */
+static int32_t MX25R3235F_RemapRetire(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, uint32_t Sector,
+                                      uint32_t SkipOffset, uint32_t SkipSize)
+{
+  uint8_t  buffer[MX25R3235F_PAGE_SIZE];
+  uint32_t source = MX25R3235F_RemapAddress(pRemap, Sector * MX25R3235F_SECTOR_4K);
+  uint32_t spare;
+  uint32_t address;
+  uint32_t offset;
+  uint32_t index;
+  uint32_t programmed;
+  uint32_t fail_addr;
+  uint8_t  secr;
+
+  if ((source == MX25R3235F_REMAP_NO_ADDRESS) || (pRemap->WriteOffset >= MX25R3235F_SECTOR_4K))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  for (spare = 0U; spare < pRemap->SpareCount; spare++)
+  {
+    if (pRemap->Spare[spare] != MX25R3235F_REMAP_FREE)
+    {
+      continue;
+    }
+
+    /* Not free any more: used below or bad */
+    pRemap->Spare[spare] = MX25R3235F_REMAP_BAD;
+    address = pRemap->SpareAddress + (spare * MX25R3235F_SECTOR_4K);
+
+    if ((MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK) ||
+        (MX25R3235F_BlockErase(Ctx, address, MX25R3235F_ERASE_4K) != MX25R3235F_OK) ||
+        (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK) ||
+        (MX25R3235F_ReadSecurityRegister(Ctx, &secr) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if ((secr & MX25R3235F_SECR_E_FAIL) != 0U)
+    {
+      /* Keep the spare out of use after a remount */
+      if (MX25R3235F_RemapRecord(Ctx, pRemap, MX25R3235F_REMAP_BAD, spare) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+      continue;
+    }
+
+    programmed = 1U;
+    for (offset = 0U; (offset < MX25R3235F_SECTOR_4K) && (programmed != 0U) && (SkipSize < MX25R3235F_SECTOR_4K);
+         offset += MX25R3235F_PAGE_SIZE)
+    {
+      if (MX25R3235F_Read(Ctx, pRemap->Mode, buffer, source + offset, MX25R3235F_PAGE_SIZE) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+
+      programmed = 0U;
+      for (index = 0U; index < MX25R3235F_PAGE_SIZE; index++)
+      {
+        if (((offset + index) >= SkipOffset) && ((offset + index) < (SkipOffset + SkipSize)))
+        {
+          buffer[index] = 0xFFU;
+        }
+        programmed |= (buffer[index] != 0xFFU) ? 1U : 0U;
+      }
+
+      if (programmed == 0U)
+      {
+        /* Nothing to copy */
+        programmed = 1U;
+      }
+      else if (MX25R3235F_Write(Ctx, pRemap->Mode, buffer, address + offset, MX25R3235F_PAGE_SIZE,
+                                MX25R3235F_VERIFY_FAIL_FLAG_SKIP_ERASED, &fail_addr) != MX25R3235F_OK)
+      {
+        if (fail_addr == 0xFFFFFFFFU)
+        {
+          return MX25R3235F_ERROR;
+        }
+        programmed = 0U;
+      }
+      else
+      {
+        /* Page copied */
+      }
+    }
+
+    if (programmed == 0U)
+    {
+      if (MX25R3235F_RemapRecord(Ctx, pRemap, MX25R3235F_REMAP_BAD, spare) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+      continue;
+    }
+
+    if (MX25R3235F_RemapRecord(Ctx, pRemap, Sector, spare) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    MX25R3235F_RemapAssign(pRemap, Sector, spare);
+
+    return MX25R3235F_OK;
+  }
+
+  return MX25R3235F_ERROR;
+}
+
+/**
+  * @brief  Append an entry to the remapping table.
+  * @param  Ctx Component object pointer
+  * @param  pRemap Remapping context pointer
+  * @param  Sector Logical sector index, or MX25R3235F_REMAP_BAD to record a
+  *         failed spare sector
+  * @param  Spare Spare sector index
+  * @retval error status
+  */
+static int32_t MX25R3235F_RemapRecord(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, uint32_t Sector, uint32_t Spare)
+{
+  uint8_t  entry[MX25R3235F_REMAP_ENTRY_SIZE];
+  uint32_t crc;
+
+  if (pRemap->WriteOffset >= MX25R3235F_SECTOR_4K)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Magic, sector, spare, check */
+  entry[0] = MX25R3235F_REMAP_MAGIC;
+  entry[1] = (uint8_t)~MX25R3235F_REMAP_MAGIC;
+  entry[2] = (uint8_t)Sector;
+  entry[3] = (uint8_t)(Sector >> 8);
+  entry[4] = (uint8_t)Spare;
+  entry[5] = 0U;
+  crc      = MX25R3235F_CRC32(0U, entry, 6U);
+  entry[6] = (uint8_t)crc;
+  entry[7] = (uint8_t)(crc >> 8);
+
+  if (MX25R3235F_Write(Ctx, pRemap->Mode, entry, pRemap->TableAddress + pRemap->WriteOffset,
+                       MX25R3235F_REMAP_ENTRY_SIZE, MX25R3235F_VERIFY_READBACK, NULL) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pRemap->WriteOffset += MX25R3235F_REMAP_ENTRY_SIZE;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_remap.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the bad sector remapping of
+  *          the MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_REMAP_H
+#define MX25R3235F_REMAP_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_Remap
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Remap_Exported_Constants MX25R3235F Remap Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Bad sector remapping configuration
+  */
+#define MX25R3235F_REMAP_MAX_SPARES                     16U          /* Max spare sectors                    */
+#define MX25R3235F_REMAP_ENTRY_SIZE                     8U           /* Remapping table entry size           */
+#define MX25R3235F_REMAP_MAGIC                          0xA5U        /* Remapping table entry marker         */
+#define MX25R3235F_REMAP_FREE                           0xFFFFU      /* Spare sector free                    */
+#define MX25R3235F_REMAP_BAD                            0xFFFEU      /* Spare sector failed or in use        */
+#define MX25R3235F_REMAP_NO_ADDRESS                     0xFFFFFFFFU  /* Retired sector held by no spare      */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Remap_Exported_Types MX25R3235F Remap Exported Types
+  * @{
+  */
+typedef struct {
+  MX25R3235F_Interface_t Mode;                                 /*!< Interface mode                               */
+  uint32_t TableAddress;                                       /*!< Address of the remapping table sector        */
+  uint32_t SpareAddress;                                       /*!< Address of the first spare sector            */
+  uint32_t SpareCount;                                         /*!< Number of spare sectors                      */
+  uint32_t WriteOffset;                                        /*!< Offset of the next table entry               */
+  uint32_t Count;                                              /*!< Number of retired sectors                    */
+  uint16_t Spare[MX25R3235F_REMAP_MAX_SPARES];                 /*!< Logical sector held by each spare            */
+  uint32_t Retired[(MX25R3235F_FLASH_SIZE / MX25R3235F_SECTOR_4K) / 32U]; /*!< Retired sectors bitmap         */
+} MX25R3235F_Remap_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Remap_Exported_Functions MX25R3235F Remap Exported Functions
+  * @{
+  */
+/* Sector Remapping Commands **************************************************/
+int32_t MX25R3235F_RemapMount(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, MX25R3235F_Interface_t Mode,
+                              uint32_t TableAddress, uint32_t SpareAddress, uint32_t SpareCount);
+uint32_t MX25R3235F_RemapAddress(const MX25R3235F_Remap_t *pRemap, uint32_t Address);
+int32_t MX25R3235F_RemapRead(XSPI_HandleTypeDef *Ctx, const MX25R3235F_Remap_t *pRemap, uint8_t *pData,
+                             uint32_t ReadAddr, uint32_t Size);
+int32_t MX25R3235F_RemapWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, uint8_t *pData,
+                              uint32_t WriteAddr, uint32_t Size);
+int32_t MX25R3235F_RemapErase(XSPI_HandleTypeDef *Ctx, MX25R3235F_Remap_t *pRemap, uint32_t BlockAddress,
+                              MX25R3235F_Erase_t BlockSize);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_REMAP_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_summary.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the per-sector summary records on top of the
+ *          MX25R3235F XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_summary.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Summary MX25R3235F Sector Summary
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Summary_Exported_Functions MX25R3235F Summary Exported Functions
+  * @{
+  */
+
+/* Sector Summary Commands ****************************************************/
+/**
+  * @brief  Write the summary record of a sector
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @param  SectorAddress Address of the 4K sector
+  * @param  pSummary Summary to write (Sequence and Info fields)
+  * @note   The record occupies the last MX25R3235F_SUMMARY_SIZE bytes of the
+  *         sector, which must be left erased by the storage layer. It is
+  *         written when the sector content is final (sector closed).
+  * @retval error status
+  */
+int32_t MX25R3235F_SummaryWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t SectorAddress,
+                                const MX25R3235F_Summary_t *pSummary)
+{
+  uint8_t record[MX25R3235F_SUMMARY_SIZE];
+
+  MX25R3235F_Put32(&record[0], MX25R3235F_SUMMARY_MAGIC);
+  MX25R3235F_Put32(&record[4], pSummary->Sequence);
+  MX25R3235F_Put32(&record[8], pSummary->Info);
+  MX25R3235F_Put32(&record[12], MX25R3235F_CRC32(0U, record, 12U));
+
+  return MX25R3235F_Write(Ctx, Mode, record, (SectorAddress & ~(MX25R3235F_SECTOR_4K - 1U)) + MX25R3235F_SUMMARY_OFFSET,
+                          MX25R3235F_SUMMARY_SIZE, MX25R3235F_VERIFY_NONE, NULL);
+}
+
+/**
+  * @brief  Read the summary records of consecutive sectors
+  * @param  Ctx Component object pointer, used when pMapped is NULL
+  * @param  Mode Interface mode, used when pMapped is NULL
+  * @param  pMapped Memory mapped window base (memory mapped mode enabled), or
+  *         NULL to use indirect read commands
+  * @param  SectorAddress Address of the first 4K sector
+  * @param  Count Number of sectors
+  * @param  pSummary Array of Count summaries
+  * @param  pDirty Number of sectors without a valid summary. Can be NULL.
+  * @note   Only MX25R3235F_SUMMARY_SIZE bytes are read per sector. Sectors with
+  *         Valid field cleared (open, being written, or interrupted) have to be
+  *         fully scanned by the storage layer.
+  * @retval error status
+  */
+int32_t MX25R3235F_SummaryScan(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint8_t *pMapped,
+                               uint32_t SectorAddress, uint32_t Count, MX25R3235F_Summary_t *pSummary, uint32_t *pDirty)
+{
+  uint8_t  record[MX25R3235F_SUMMARY_SIZE];
+  uint32_t address = (SectorAddress & ~(MX25R3235F_SECTOR_4K - 1U)) + MX25R3235F_SUMMARY_OFFSET;
+  uint32_t dirty = 0U;
+  uint32_t index;
+
+  for (index = 0U; index < Count; index++)
+  {
+    if (pMapped != NULL)
+    {
+      (void)memcpy(record, &pMapped[address], MX25R3235F_SUMMARY_SIZE);
+    }
+    else if (MX25R3235F_Read(Ctx, Mode, record, address, MX25R3235F_SUMMARY_SIZE) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+    else
+    {
+      /* Record read by indirect command */
+    }
+
+    pSummary[index].Sequence = MX25R3235F_Get32(&record[4]);
+    pSummary[index].Info     = MX25R3235F_Get32(&record[8]);
+    pSummary[index].Valid    = ((MX25R3235F_Get32(&record[0]) == MX25R3235F_SUMMARY_MAGIC) &&
+                                (MX25R3235F_Get32(&record[12]) == MX25R3235F_CRC32(0U, record, 12U))) ? 1U : 0U;
+
+    if (pSummary[index].Valid == 0U)
+    {
+      dirty++;
+    }
+
+    address += MX25R3235F_SECTOR_4K;
+  }
+
+  if (pDirty != NULL)
+  {
+    *pDirty = dirty;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
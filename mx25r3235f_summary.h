@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_summary.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the per-sector summary
+  *          records of the MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_SUMMARY_H
+#define MX25R3235F_SUMMARY_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_Summary
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Summary_Exported_Constants MX25R3235F Summary Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Sector summary configuration
+  */
+#define MX25R3235F_SUMMARY_SIZE                         16U          /* Summary record size                  */
+#define MX25R3235F_SUMMARY_OFFSET                       (MX25R3235F_SECTOR_4K - MX25R3235F_SUMMARY_SIZE)
+#define MX25R3235F_SUMMARY_MAGIC                        0x304D5553U  /* Summary record magic, "SUM0"         */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Summary_Exported_Types MX25R3235F Summary Exported Types
+  * @{
+  */
+typedef struct {
+  uint32_t Sequence;                                           /*!< Storage layer sequence number                */
+  uint32_t Info;                                               /*!< Storage layer information                    */
+  uint32_t Valid;                                              /*!< Set by the scan when the record is valid     */
+} MX25R3235F_Summary_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Summary_Exported_Functions MX25R3235F Summary Exported Functions
+  * @{
+  */
+/* Sector Summary Commands ****************************************************/
+int32_t MX25R3235F_SummaryWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, uint32_t SectorAddress,
+                                const MX25R3235F_Summary_t *pSummary);
+int32_t MX25R3235F_SummaryScan(XSPI_HandleTypeDef *Ctx, MX25R3235F_Interface_t Mode, const uint8_t *pMapped,
+                               uint32_t SectorAddress, uint32_t Count, MX25R3235F_Summary_t *pSummary, uint32_t *pDirty);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_SUMMARY_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,542 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_update.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the dual image A/B update engine on top of the
+ *          MX25R3235F XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_update.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Update MX25R3235F Dual Image Update
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Update_Private_Functions_Prototypes MX25R3235F Update Private Functions Prototypes
+  * @{
+  */
+static int32_t MX25R3235F_UpdateEraseAhead(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate);
+static int32_t MX25R3235F_UpdateEraseWait(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate);
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Update_Exported_Functions MX25R3235F Update Exported Functions
+  * @{
+  */
+
+/* Dual Image Update Commands *************************************************/
+/**
+  * @brief  Initialize the dual image update engine
+  * @param  Ctx Component object pointer
+  * @param  pUpdate Update engine pointer
+  * @param  HeaderAddress Address of the two 4K header sectors
+  * @param  Slot0Address Address of image slot 0, 64K aligned
+  * @param  Slot1Address Address of image slot 1, 64K aligned
+  * @param  SlotSize Size of each slot, multiple of 64K
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @note   The committed image is the valid header with the most recent
+  *         sequence number: ActiveSlot and ActiveSize fields.
+  * @retval error status
+  */
+int32_t MX25R3235F_UpdateInit(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate, uint32_t HeaderAddress,
+                              uint32_t Slot0Address, uint32_t Slot1Address, uint32_t SlotSize, MX25R3235F_Interface_t Mode)
+{
+  uint8_t  header[MX25R3235F_UPDATE_HEADER_SIZE];
+  uint32_t index;
+  uint32_t sequence;
+
+  if ((MX25R3235F_DEVICE_NUMBER != 1U) || (((Slot0Address | Slot1Address | SlotSize) % MX25R3235F_BLOCK_64K) != 0U) ||
+      (SlotSize > (MX25R3235F_UPDATE_SECTORS * MX25R3235F_SECTOR_4K)) || ((HeaderAddress % MX25R3235F_SECTOR_4K) != 0U))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  (void)memset(pUpdate, 0, sizeof(MX25R3235F_Update_t));
+  pUpdate->HeaderAddress  = HeaderAddress;
+  pUpdate->SlotAddress[0] = Slot0Address;
+  pUpdate->SlotAddress[1] = Slot1Address;
+  pUpdate->SlotSize       = SlotSize;
+  pUpdate->Mode           = Mode;
+  pUpdate->ActiveSlot     = MX25R3235F_UPDATE_NO_SLOT;
+  pUpdate->EraseAddress   = MX25R3235F_UPDATE_NO_ERASE;
+
+  for (index = 0U; index < 2U; index++)
+  {
+    if (MX25R3235F_Read(Ctx, Mode, header, HeaderAddress + (index * MX25R3235F_SECTOR_4K), MX25R3235F_UPDATE_HEADER_SIZE) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    /* Magic, slot, image size, image CRC, sequence, header CRC */
+    sequence = MX25R3235F_Get32(&header[16]);
+    if ((MX25R3235F_Get32(&header[0]) == MX25R3235F_UPDATE_MAGIC) && (MX25R3235F_Get32(&header[4]) < 2U) &&
+        (MX25R3235F_Get32(&header[20]) == MX25R3235F_CRC32(0U, header, 20U)) &&
+        ((pUpdate->ActiveSlot == MX25R3235F_UPDATE_NO_SLOT) || ((int32_t)(sequence - pUpdate->Sequence) > 0)))
+    {
+      pUpdate->ActiveSlot   = MX25R3235F_Get32(&header[4]);
+      pUpdate->ActiveSize   = MX25R3235F_Get32(&header[8]);
+      pUpdate->Sequence     = sequence;
+      pUpdate->HeaderSector = index;
+    }
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Start the update of the inactive slot
+  * @param  Ctx Component object pointer
+  * @param  pUpdate Update engine pointer
+  * @param  ImageSize Size of the new image
+  * @param  pSectorCrc CRC-32 of each 4K sector of the new image (last one
+  *         computed on the image bytes only), or NULL to rewrite everything
+  * @note   Sectors of the slot already holding the new content are neither
+  *         erased nor programmed. The erase of the first sector to update is
+  *         started and runs in the background.
+  * @retval error status
+  */
+int32_t MX25R3235F_UpdateBegin(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate, uint32_t ImageSize,
+                               const uint32_t *pSectorCrc)
+{
+  uint8_t  buffer[MX25R3235F_PAGE_SIZE];
+  uint32_t sector;
+  uint32_t length;
+  uint32_t crc;
+
+  if ((ImageSize == 0U) || (ImageSize > pUpdate->SlotSize) || (pUpdate->EraseAddress != MX25R3235F_UPDATE_NO_ERASE))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pUpdate->TargetSlot      = (pUpdate->ActiveSlot == 0U) ? 1U : 0U;
+  pUpdate->ImageSize       = ImageSize;
+  pUpdate->Offset          = 0U;
+  pUpdate->Crc             = 0U;
+  pUpdate->EraseNext       = 0U;
+  pUpdate->ProgrammedPages = 0U;
+  pUpdate->SkippedPages    = 0U;
+  pUpdate->ErasedSectors   = 0U;
+  (void)memset(pUpdate->Changed, 0, sizeof(pUpdate->Changed));
+  (void)memset(pUpdate->Erased, 0, sizeof(pUpdate->Erased));
+
+  /* Find the sectors whose content differs from the new image */
+  for (sector = 0U; (sector * MX25R3235F_SECTOR_4K) < ImageSize; sector++)
+  {
+    crc = 0U;
+    if (pSectorCrc != NULL)
+    {
+      length = ImageSize - (sector * MX25R3235F_SECTOR_4K);
+      if (length > MX25R3235F_SECTOR_4K)
+      {
+        length = MX25R3235F_SECTOR_4K;
+      }
+
+      if (MX25R3235F_ReadCRC32(Ctx, pUpdate->Mode, pUpdate->SlotAddress[pUpdate->TargetSlot] + (sector * MX25R3235F_SECTOR_4K),
+                               length, buffer, MX25R3235F_PAGE_SIZE, &crc) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+    }
+
+    if ((pSectorCrc == NULL) || (crc != pSectorCrc[sector]))
+    {
+      pUpdate->Changed[sector / 32U] |= (1UL << (sector % 32U));
+    }
+  }
+
+  return MX25R3235F_UpdateEraseAhead(Ctx, pUpdate);
+}
+
+/**
+  * @brief  Write the next part of the new image
+  * @param  Ctx Component object pointer
+  * @param  pUpdate Update engine pointer
+  * @param  pData Pointer to the image data
+  * @param  Size Size of the image data
+  * @note   Pages of unchanged sectors and fully erased pages are skipped.
+  *         The erase of the next sector or block to update runs in the
+  *         background: it is suspended while the pages of this call are
+  *         programmed and resumed before returning, so that it progresses
+  *         while the application receives the next part of the image. It
+  *         is only suspended once it ran for MX25R3235F_RESUME_TO_SUSPEND_TIME
+  *         since its start or last resume, so that frequent small writes do
+  *         not starve it. After an error, the update is ended with
+  *         MX25R3235F_UpdateAbort() before a new MX25R3235F_UpdateBegin().
+  * @retval error status
+  */
+int32_t MX25R3235F_UpdateWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate, uint8_t *pData, uint32_t Size)
+{
+  uint32_t length;
+  uint32_t sector;
+  uint32_t index;
+  int32_t  ret = MX25R3235F_OK;
+
+  if (Size > (pUpdate->ImageSize - pUpdate->Offset))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  while ((Size > 0U) && (ret == MX25R3235F_OK))
+  {
+    length = MX25R3235F_PAGE_SIZE - (pUpdate->Offset % MX25R3235F_PAGE_SIZE);
+    if (length > Size)
+    {
+      length = Size;
+    }
+
+    sector = pUpdate->Offset / MX25R3235F_SECTOR_4K;
+    pUpdate->Crc = MX25R3235F_CRC32(pUpdate->Crc, pData, length);
+
+    /* Erased content does not need programming */
+    index = 0U;
+    while ((index < length) && (pData[index] == 0xFFU))
+    {
+      index++;
+    }
+
+    if (((pUpdate->Changed[sector / 32U] & (1UL << (sector % 32U))) == 0U) || (index == length))
+    {
+      pUpdate->SkippedPages++;
+    }
+    else
+    {
+      /* Wait for the erase of this sector, then start the next one */
+      while ((ret == MX25R3235F_OK) && ((pUpdate->Erased[sector / 32U] & (1UL << (sector % 32U))) == 0U))
+      {
+        ret = MX25R3235F_UpdateEraseWait(Ctx, pUpdate);
+        if (ret == MX25R3235F_OK)
+        {
+          ret = MX25R3235F_UpdateEraseAhead(Ctx, pUpdate);
+        }
+      }
+
+      /* Program with the background erase suspended */
+      if ((ret == MX25R3235F_OK) && (pUpdate->EraseAddress != MX25R3235F_UPDATE_NO_ERASE) && (pUpdate->Suspended == 0U))
+      {
+        while ((MX25R3235F_TimingGetTime() - pUpdate->ResumeTime) <=
+               (MX25R3235F_RESUME_TO_SUSPEND_TIME + MX25R3235F_TIME_RESOLUTION))
+        {
+          /* Let the erase progress since its start or last resume */
+        }
+
+        ret = MX25R3235F_Suspend(Ctx);
+        if (ret == MX25R3235F_OK)
+        {
+          pUpdate->Suspended = 1U;
+          ret = MX25R3235F_AutoPollingMemReady(Ctx, HAL_XSPI_TIMEOUT_DEFAULT_VALUE);
+        }
+      }
+
+      if (ret == MX25R3235F_OK)
+      {
+        ret = MX25R3235F_Write(Ctx, pUpdate->Mode, pData,
+                               pUpdate->SlotAddress[pUpdate->TargetSlot] + pUpdate->Offset, length,
+                               MX25R3235F_VERIFY_FAIL_FLAG, NULL);
+        if (ret == MX25R3235F_OK)
+        {
+          pUpdate->ProgrammedPages++;
+        }
+      }
+    }
+
+    pData           += length;
+    pUpdate->Offset += length;
+    Size            -= length;
+  }
+
+  /* Let the background erase progress */
+  if (pUpdate->Suspended != 0U)
+  {
+    if (MX25R3235F_Resume(Ctx) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+    pUpdate->Suspended  = 0U;
+    pUpdate->ResumeTime = MX25R3235F_TimingGetTime();
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Verify the new image and make it the active one
+  * @param  Ctx Component object pointer
+  * @param  pUpdate Update engine pointer
+  * @note   The header is written in the header sector not holding the current
+  *         one. It is only valid once fully programmed (header CRC): a power
+  *         loss before that point keeps the previous image active.
+  * @retval error status
+  */
+int32_t MX25R3235F_UpdateCommit(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate)
+{
+  uint8_t  buffer[MX25R3235F_PAGE_SIZE];
+  uint32_t crc = 0U;
+  uint32_t sector;
+
+  if ((pUpdate->ImageSize == 0U) || (pUpdate->Offset != pUpdate->ImageSize))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  /* Complete the erases, including changed sectors with erased new content
+     never reached by a program */
+  do
+  {
+    if ((MX25R3235F_UpdateEraseWait(Ctx, pUpdate) != MX25R3235F_OK) ||
+        (MX25R3235F_UpdateEraseAhead(Ctx, pUpdate) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+  } while (pUpdate->EraseAddress != MX25R3235F_UPDATE_NO_ERASE);
+
+  if ((MX25R3235F_ReadCRC32(Ctx, pUpdate->Mode, pUpdate->SlotAddress[pUpdate->TargetSlot], pUpdate->ImageSize,
+                            buffer, MX25R3235F_PAGE_SIZE, &crc) != MX25R3235F_OK) || (crc != pUpdate->Crc))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  sector = (pUpdate->ActiveSlot == MX25R3235F_UPDATE_NO_SLOT) ? 0U : (pUpdate->HeaderSector ^ 1U);
+
+  if (MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_BlockErase(Ctx, pUpdate->HeaderAddress + (sector * MX25R3235F_SECTOR_4K), MX25R3235F_ERASE_4K) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_SECTOR_4K_ERASE_MAX_TIME) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  MX25R3235F_Put32(&buffer[0], MX25R3235F_UPDATE_MAGIC);
+  MX25R3235F_Put32(&buffer[4], pUpdate->TargetSlot);
+  MX25R3235F_Put32(&buffer[8], pUpdate->ImageSize);
+  MX25R3235F_Put32(&buffer[12], pUpdate->Crc);
+  MX25R3235F_Put32(&buffer[16], pUpdate->Sequence + 1U);
+  MX25R3235F_Put32(&buffer[20], MX25R3235F_CRC32(0U, buffer, 20U));
+
+  if (MX25R3235F_Write(Ctx, pUpdate->Mode, buffer, pUpdate->HeaderAddress + (sector * MX25R3235F_SECTOR_4K),
+                       MX25R3235F_UPDATE_HEADER_SIZE, MX25R3235F_VERIFY_READBACK, NULL) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pUpdate->ActiveSlot   = pUpdate->TargetSlot;
+  pUpdate->ActiveSize   = pUpdate->ImageSize;
+  pUpdate->Sequence    += 1U;
+  pUpdate->HeaderSector = sector;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Abandon the update in progress
+  * @param  Ctx Component object pointer
+  * @param  pUpdate Update engine pointer
+  * @note   To be called after an error of MX25R3235F_UpdateWrite() or
+  *         MX25R3235F_UpdateCommit(), or to cancel an update. A suspended
+  *         background erase is resumed and waited for; MX25R3235F_UpdateBegin()
+  *         fails while it is still pending. The committed image is kept.
+  * @retval error status
+  */
+int32_t MX25R3235F_UpdateAbort(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate)
+{
+  if (pUpdate->EraseAddress != MX25R3235F_UPDATE_NO_ERASE)
+  {
+    if (pUpdate->Suspended != 0U)
+    {
+      if (MX25R3235F_Resume(Ctx) != MX25R3235F_OK)
+      {
+        return MX25R3235F_ERROR;
+      }
+      pUpdate->Suspended = 0U;
+    }
+
+    if (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_BLOCK_64K_ERASE_MAX_TIME) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+    pUpdate->EraseAddress = MX25R3235F_UPDATE_NO_ERASE;
+  }
+
+  pUpdate->ImageSize = 0U;
+  pUpdate->Offset    = 0U;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Update_Private_Functions MX25R3235F Update Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Start the erase of the next sectors to update, if none is running.
+  * @param  Ctx Component object pointer
+  * @param  pUpdate Update engine pointer
+  * @note   A 64K block erase is used when all the sectors of the block have to
+  *         be updated, 4K sector erases otherwise.
+  * @retval error status
+  */
+static int32_t MX25R3235F_UpdateEraseAhead(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate)
+{
+  uint32_t sectors = (pUpdate->ImageSize + MX25R3235F_SECTOR_4K - 1U) / MX25R3235F_SECTOR_4K;
+  uint32_t per_block = MX25R3235F_BLOCK_64K / MX25R3235F_SECTOR_4K;
+  uint32_t sector;
+  uint32_t index;
+  MX25R3235F_Erase_t erase = MX25R3235F_ERASE_4K;
+
+  if (pUpdate->EraseAddress != MX25R3235F_UPDATE_NO_ERASE)
+  {
+    return MX25R3235F_OK;
+  }
+
+  for (sector = pUpdate->EraseNext; sector < sectors; sector++)
+  {
+    if ((pUpdate->Changed[sector / 32U] & (1UL << (sector % 32U))) != 0U)
+    {
+      break;
+    }
+  }
+
+  pUpdate->EraseNext = sector;
+  if (sector >= sectors)
+  {
+    return MX25R3235F_OK;
+  }
+
+  pUpdate->EraseSize = 1U;
+  if ((sector % per_block) == 0U)
+  {
+    index = 0U;
+    while ((index < per_block) && ((sector + index) < sectors) &&
+           ((pUpdate->Changed[(sector + index) / 32U] & (1UL << ((sector + index) % 32U))) != 0U))
+    {
+      index++;
+    }
+
+    if (index == per_block)
+    {
+      erase = MX25R3235F_ERASE_64K;
+      pUpdate->EraseSize = per_block;
+    }
+  }
+
+  if (MX25R3235F_WriteEnable(Ctx) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (MX25R3235F_BlockErase(Ctx, pUpdate->SlotAddress[pUpdate->TargetSlot] + (sector * MX25R3235F_SECTOR_4K), erase) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pUpdate->EraseAddress = sector;
+  pUpdate->EraseNext    = sector + pUpdate->EraseSize;
+  pUpdate->ResumeTime   = MX25R3235F_TimingGetTime();
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Wait for the end of the running erase.
+  * @param  Ctx Component object pointer
+  * @param  pUpdate Update engine pointer
+  * @retval error status
+  */
+static int32_t MX25R3235F_UpdateEraseWait(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate)
+{
+  uint32_t sector;
+  uint8_t  secr;
+
+  if (pUpdate->EraseAddress == MX25R3235F_UPDATE_NO_ERASE)
+  {
+    return MX25R3235F_OK;
+  }
+
+  if (pUpdate->Suspended != 0U)
+  {
+    if (MX25R3235F_Resume(Ctx) != MX25R3235F_OK)
+    {
+      return MX25R3235F_ERROR;
+    }
+    pUpdate->Suspended = 0U;
+  }
+
+  if (MX25R3235F_AutoPollingMemReady(Ctx, MX25R3235F_BLOCK_64K_ERASE_MAX_TIME) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if ((MX25R3235F_ReadSecurityRegister(Ctx, &secr) != MX25R3235F_OK) || ((secr & MX25R3235F_SECR_E_FAIL) != 0U))
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  for (sector = pUpdate->EraseAddress; sector < (pUpdate->EraseAddress + pUpdate->EraseSize); sector++)
+  {
+    pUpdate->Erased[sector / 32U] |= (1UL << (sector % 32U));
+  }
+
+  pUpdate->ErasedSectors += pUpdate->EraseSize;
+  pUpdate->EraseAddress   = MX25R3235F_UPDATE_NO_ERASE;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
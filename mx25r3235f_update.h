@@ -0,0 +1,134 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_update.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the dual image A/B update
+  *          engine of the MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_UPDATE_H
+#define MX25R3235F_UPDATE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_Update
+  * @{
+  */
+
+/** @defgroup MX25R3235F_Update_Exported_Constants MX25R3235F Update Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Dual image update configuration
+  */
+#define MX25R3235F_UPDATE_SECTORS                       ((MX25R3235F_FLASH_SIZE / 2U) / MX25R3235F_SECTOR_4K) /* Max slot sectors */
+#define MX25R3235F_UPDATE_HEADER_SIZE                   24U          /* Image header size                    */
+#define MX25R3235F_UPDATE_MAGIC                         0x31474D49U  /* Image header magic, "IMG1"           */
+#define MX25R3235F_UPDATE_NO_SLOT                       0xFFFFFFFFU  /* No committed image                   */
+#define MX25R3235F_UPDATE_NO_ERASE                      0xFFFFFFFFU  /* No erase running                     */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Update_Exported_Types MX25R3235F Update Exported Types
+  * @{
+  */
+typedef struct {
+  uint32_t               HeaderAddress;                        /*!< Address of the two header sectors            */
+  uint32_t               SlotAddress[2];                       /*!< Address of each image slot                   */
+  uint32_t               SlotSize;                             /*!< Size of each image slot                      */
+  MX25R3235F_Interface_t Mode;                                 /*!< Interface mode                               */
+  uint32_t               ActiveSlot;                           /*!< Slot of the committed image                  */
+  uint32_t               ActiveSize;                           /*!< Size of the committed image                  */
+  uint32_t               Sequence;                             /*!< Sequence number of the last header           */
+  uint32_t               HeaderSector;                         /*!< Header sector holding the last header        */
+  uint32_t               TargetSlot;                           /*!< Slot being updated                           */
+  uint32_t               ImageSize;                            /*!< Size of the image being written              */
+  uint32_t               Offset;                               /*!< Amount of image data received                */
+  uint32_t               Crc;                                  /*!< CRC-32 of the image data received            */
+  uint32_t               EraseAddress;                         /*!< First sector of the running erase            */
+  uint32_t               EraseSize;                            /*!< Number of sectors of the running erase       */
+  uint32_t               EraseNext;                            /*!< Next sector to consider for erase            */
+  uint32_t               Suspended;                            /*!< Running erase suspended                      */
+  uint32_t               ResumeTime;                           /*!< Start or resume time of the running erase    */
+  uint32_t               Changed[MX25R3235F_UPDATE_SECTORS / 32U]; /*!< Sectors to update                        */
+  uint32_t               Erased[MX25R3235F_UPDATE_SECTORS / 32U];  /*!< Sectors erased                           */
+  uint32_t               ProgrammedPages;                      /*!< Statistics: pages programmed                 */
+  uint32_t               SkippedPages;                         /*!< Statistics: pages skipped                    */
+  uint32_t               ErasedSectors;                        /*!< Statistics: sectors erased                   */
+} MX25R3235F_Update_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_Update_Exported_Functions MX25R3235F Update Exported Functions
+  * @{
+  */
+/* Dual Image Update Commands *************************************************/
+int32_t MX25R3235F_UpdateInit(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate, uint32_t HeaderAddress,
+                              uint32_t Slot0Address, uint32_t Slot1Address, uint32_t SlotSize, MX25R3235F_Interface_t Mode);
+int32_t MX25R3235F_UpdateBegin(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate, uint32_t ImageSize,
+                               const uint32_t *pSectorCrc);
+int32_t MX25R3235F_UpdateWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate, uint8_t *pData, uint32_t Size);
+int32_t MX25R3235F_UpdateCommit(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate);
+int32_t MX25R3235F_UpdateAbort(XSPI_HandleTypeDef *Ctx, MX25R3235F_Update_t *pUpdate);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_UPDATE_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,238 @@
+/**
+ ******************************************************************************
+ * @file    mx25r3235f_wb.c
+ * @modify  MCD Application Team
+ * @brief   This file provides the page write-back buffer on top of the
+ *          MX25R3235F XSPI driver.
+ ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f_wb.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @defgroup MX25R3235F_WB MX25R3235F Write-Back Buffer
+  * @{
+  */
+
+/** @defgroup MX25R3235F_WB_Exported_Functions MX25R3235F WB Exported Functions
+  * @{
+  */
+
+/* Write-Back Buffer Commands *************************************************/
+/**
+  * @brief  Initialize a page write-back buffer
+  * @param  pBuffer Write-back buffer pointer
+  * @param  Mode Interface mode, SPI or QUAD_INOUT
+  * @param  FlushTime Maximum time data stays buffered (ms), 0 to flush only
+  *         on page change, page fill or MX25R3235F_WBSync()
+  * @retval error status
+  */
+int32_t MX25R3235F_WBInit(MX25R3235F_WriteBuffer_t *pBuffer, MX25R3235F_Interface_t Mode, uint32_t FlushTime)
+{
+  (void)memset(pBuffer, 0, sizeof(MX25R3235F_WriteBuffer_t));
+  (void)memset(pBuffer->Data, 0xFF, MX25R3235F_PAGE_SIZE);
+  pBuffer->Mode      = Mode;
+  pBuffer->FlushTime = FlushTime;
+  pBuffer->Address   = MX25R3235F_WB_EMPTY;
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Write an amount of data through the write-back buffer
+  * @param  Ctx Component object pointer
+  * @param  pBuffer Write-back buffer pointer
+  * @param  pData Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size Size of data to write
+  * @note   Writes to the buffered page are merged in RAM with the program
+  *         semantics of the memory (bits only go from 1 to 0). The page is
+  *         programmed once full, or when a write targets another page.
+  * @retval error status
+  */
+int32_t MX25R3235F_WBWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_WriteBuffer_t *pBuffer, const uint8_t *pData,
+                           uint32_t WriteAddr, uint32_t Size)
+{
+  uint32_t page;
+  uint32_t offset;
+  uint32_t length;
+  uint32_t index;
+
+  while (Size > 0U)
+  {
+    page   = WriteAddr - (WriteAddr % MX25R3235F_PAGE_SIZE);
+    offset = WriteAddr % MX25R3235F_PAGE_SIZE;
+    length = MX25R3235F_PAGE_SIZE - offset;
+    if (length > Size)
+    {
+      length = Size;
+    }
+
+    if ((pBuffer->Address != page) && (MX25R3235F_WBSync(Ctx, pBuffer) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    if (pBuffer->Address == MX25R3235F_WB_EMPTY)
+    {
+      pBuffer->Address   = page;
+      pBuffer->Start     = offset;
+      pBuffer->End       = offset + length;
+      pBuffer->FirstTick = HAL_GetTick();
+    }
+    else
+    {
+      pBuffer->Start = (offset < pBuffer->Start) ? offset : pBuffer->Start;
+      pBuffer->End   = ((offset + length) > pBuffer->End) ? (offset + length) : pBuffer->End;
+    }
+
+    for (index = 0U; index < length; index++)
+    {
+      pBuffer->Data[offset + index] &= pData[index];
+    }
+
+    if (((pBuffer->End - pBuffer->Start) == MX25R3235F_PAGE_SIZE) && (MX25R3235F_WBSync(Ctx, pBuffer) != MX25R3235F_OK))
+    {
+      return MX25R3235F_ERROR;
+    }
+
+    pData     += length;
+    WriteAddr += length;
+    Size      -= length;
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Read an amount of data, including the data still buffered
+  * @param  Ctx Component object pointer
+  * @param  pBuffer Write-back buffer pointer
+  * @param  pData Pointer to data to be read
+  * @param  ReadAddr Read start address
+  * @param  Size Size of data to read
+  * @note   Only the reads done with this function see the buffered data:
+  *         MX25R3235F_Read() and the memory mapped window return the content
+  *         of the memory, which lags behind until MX25R3235F_WBSync().
+  * @retval error status
+  */
+int32_t MX25R3235F_WBRead(XSPI_HandleTypeDef *Ctx, const MX25R3235F_WriteBuffer_t *pBuffer, uint8_t *pData,
+                          uint32_t ReadAddr, uint32_t Size)
+{
+  uint32_t start;
+  uint32_t end;
+
+  if (MX25R3235F_Read(Ctx, pBuffer->Mode, pData, ReadAddr, Size) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  if (pBuffer->Address == MX25R3235F_WB_EMPTY)
+  {
+    return MX25R3235F_OK;
+  }
+
+  /* Overlap of the read area with the buffered range */
+  start = pBuffer->Address + pBuffer->Start;
+  end   = pBuffer->Address + pBuffer->End;
+  start = (start > ReadAddr) ? start : ReadAddr;
+  end   = (end < (ReadAddr + Size)) ? end : (ReadAddr + Size);
+
+  for (; start < end; start++)
+  {
+    pData[start - ReadAddr] &= pBuffer->Data[start - pBuffer->Address];
+  }
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Program the buffered data
+  * @param  Ctx Component object pointer
+  * @param  pBuffer Write-back buffer pointer
+  * @note   On failure the data stays buffered, so that the call can be retried.
+  * @retval error status
+  */
+int32_t MX25R3235F_WBSync(XSPI_HandleTypeDef *Ctx, MX25R3235F_WriteBuffer_t *pBuffer)
+{
+  if (pBuffer->Address == MX25R3235F_WB_EMPTY)
+  {
+    return MX25R3235F_OK;
+  }
+
+  if (MX25R3235F_Write(Ctx, pBuffer->Mode, &pBuffer->Data[pBuffer->Start], pBuffer->Address + pBuffer->Start,
+                       pBuffer->End - pBuffer->Start, MX25R3235F_VERIFY_NONE, NULL) != MX25R3235F_OK)
+  {
+    return MX25R3235F_ERROR;
+  }
+
+  pBuffer->Programs++;
+  pBuffer->Bytes  += pBuffer->End - pBuffer->Start;
+  pBuffer->Address = MX25R3235F_WB_EMPTY;
+  (void)memset(pBuffer->Data, 0xFF, MX25R3235F_PAGE_SIZE);
+
+  return MX25R3235F_OK;
+}
+
+/**
+  * @brief  Program the buffered data once it is older than the flush time
+  * @param  Ctx Component object pointer
+  * @param  pBuffer Write-back buffer pointer
+  * @note   To be called periodically, from the application idle loop or a timer.
+  * @retval error status
+  */
+int32_t MX25R3235F_WBProcess(XSPI_HandleTypeDef *Ctx, MX25R3235F_WriteBuffer_t *pBuffer)
+{
+  if ((pBuffer->Address == MX25R3235F_WB_EMPTY) || (pBuffer->FlushTime == 0U) ||
+      ((HAL_GetTick() - pBuffer->FirstTick) < pBuffer->FlushTime))
+  {
+    return MX25R3235F_OK;
+  }
+
+  return MX25R3235F_WBSync(Ctx, pBuffer);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,117 @@
+/**
+  ******************************************************************************
+  * @file    mx25r3235f_wb.h
+  * @author  MCD Application Team
+  * @brief   This file contains the description of the page write-back buffer of
+  *          the MX25R3235F XSPI memory.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MX25R3235F_WB_H
+#define MX25R3235F_WB_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mx25r3235f.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup Components
+  * @{
+  */
+
+/** @addtogroup MX25R3235F
+  * @{
+  */
+
+/** @addtogroup MX25R3235F_WB
+  * @{
+  */
+
+/** @defgroup MX25R3235F_WB_Exported_Constants MX25R3235F WB Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  MX25R3235F Write-back buffer configuration
+  */
+#define MX25R3235F_WB_EMPTY                             0xFFFFFFFFU  /* No page buffered                     */
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_WB_Exported_Types MX25R3235F WB Exported Types
+  * @{
+  */
+typedef struct {
+  MX25R3235F_Interface_t Mode;                                 /*!< Interface mode                               */
+  uint32_t FlushTime;                                          /*!< Maximum buffering time (ms), 0=no timer      */
+  uint32_t Address;                                            /*!< Buffered page, MX25R3235F_WB_EMPTY if none   */
+  uint32_t Start;                                              /*!< Start offset of the buffered range           */
+  uint32_t End;                                                /*!< End offset of the buffered range             */
+  uint32_t FirstTick;                                          /*!< Tick of the oldest buffered write            */
+  uint32_t Programs;                                           /*!< Statistics: page programs issued             */
+  uint32_t Bytes;                                              /*!< Statistics: bytes programmed                 */
+  uint8_t  Data[MX25R3235F_PAGE_SIZE];                         /*!< Page content, 0xFF outside written bytes     */
+} MX25R3235F_WriteBuffer_t;
+
+/**
+  * @}
+  */
+
+/** @defgroup MX25R3235F_WB_Exported_Functions MX25R3235F WB Exported Functions
+  * @{
+  */
+/* Write-Back Buffer Commands *************************************************/
+int32_t MX25R3235F_WBInit(MX25R3235F_WriteBuffer_t *pBuffer, MX25R3235F_Interface_t Mode, uint32_t FlushTime);
+int32_t MX25R3235F_WBWrite(XSPI_HandleTypeDef *Ctx, MX25R3235F_WriteBuffer_t *pBuffer, const uint8_t *pData,
+                           uint32_t WriteAddr, uint32_t Size);
+int32_t MX25R3235F_WBRead(XSPI_HandleTypeDef *Ctx, const MX25R3235F_WriteBuffer_t *pBuffer, uint8_t *pData,
+                          uint32_t ReadAddr, uint32_t Size);
+int32_t MX25R3235F_WBSync(XSPI_HandleTypeDef *Ctx, MX25R3235F_WriteBuffer_t *pBuffer);
+int32_t MX25R3235F_WBProcess(XSPI_HandleTypeDef *Ctx, MX25R3235F_WriteBuffer_t *pBuffer);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MX25R3235F_WB_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/